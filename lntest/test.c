@@ -25,6 +25,7 @@ Copyright 2008-2009 Petr Kubanek*/
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
 #include <libnova/libnova.h>
 #include <sys/time.h>
 #ifndef __WIN32__
@@ -939,6 +940,1032 @@ static int vsop87_test(void)
 	return failed;
 }
 
+/* compare the (possibly vectorised) series kernel against a plain C sum */
+static int vsop87_series_test(void)
+{
+	struct ln_vsop series[103];
+	double t, calc, expect;
+	int i, failed = 0;
+
+	for (i = 0; i < 103; i++) {
+		series[i].A = 1.0e-3 / (i + 1);
+		series[i].B = 0.37 * i;
+		series[i].C = 17.3 * i * i;
+	}
+
+	for (t = -3.0; t <= 3.0; t += 1.5) {
+		expect = 0.0;
+		for (i = 0; i < 103; i++)
+			expect += series[i].A * cos(series[i].B + series[i].C * t);
+
+		calc = ln_calc_series(series, 103, t);
+		failed += test_result("(VSOP87) series kernel against C sum  ",
+			calc, expect, 0.000000000001);
+	}
+
+	/* arguments too large for the vector cosine */
+	series[5].C = 1.0e12;
+	expect = 0.0;
+	for (i = 0; i < 103; i++)
+		expect += series[i].A * cos(series[i].B + series[i].C * 0.25);
+	calc = ln_calc_series(series, 103, 0.25);
+	failed += test_result("(VSOP87) series kernel large argument  ",
+		calc, expect, 0.000000000001);
+
+	return failed;
+}
+
+static int vsop87_sweep_test(void)
+{
+	/* enough terms for the vector kernels and a remainder */
+	struct ln_vsop series[11] = {
+		{1.0, 0.5, 6283.0758},
+		{0.01, 2.0, 77713.7715},
+		{0.0001, 4.0, 529.691},
+		{0.03, 1.1, 12566.1517},
+		{0.002, 5.9, 0.0},
+		{0.0005, 3.3, 26087.9031},
+		{0.0004, 0.2, 213.299},
+		{0.0003, 2.7, 1577.3435},
+		{0.0002, 4.4, 5223.6939},
+		{0.0001, 6.1, 155.4204},
+		{0.00005, 1.9, 83996.8473},
+	};
+	double values[100], worst = 0.0, t = 0.1;
+	int i, failed = 0;
+
+	ln_calc_series_sweep(series, 11, t, 0.0001, 100, values);
+	for (i = 0; i < 100; i++)
+		worst = fmax(worst, fabs(values[i] -
+			ln_calc_series(series, 11, t + i * 0.0001)));
+	failed += test_result("(VSOP87) series sweep  ", worst, 0.0, 1e-12);
+
+	return failed;
+}
+
+/* alternating epochs must give the same positions as single calls */
+static int vsop87_cache_test(void)
+{
+	struct ln_helio_posn pos[4], again;
+	struct ln_nutation nut[2], nut_again;
+	double JD[4] = {2448976.5, 2451545.0, 2448976.5 + 1.0 / 24.0, 0.0};
+	int i, j, failed = 0;
+
+	for (i = 0; i < 4; i++)
+		ln_get_venus_helio_coords(JD[i], &pos[i]);
+	ln_get_nutation(JD[0], &nut[0]);
+	ln_get_nutation(JD[1], &nut[1]);
+
+	for (j = 0; j < 3; j++) {
+		for (i = 3; i >= 0; i--) {
+			ln_get_venus_helio_coords(JD[i], &again);
+			failed += test_result("(VSOP87) Venus cached L  ",
+				again.L, pos[i].L, 0.0);
+			failed += test_result("(VSOP87) Venus cached R  ",
+				again.R, pos[i].R, 0.0);
+		}
+	}
+
+	/* the single entry cache returned zeroes for JD 0 */
+	failed += test_result("(VSOP87) Venus R on JD 0  ",
+		pos[3].R > 0.7, 1, 0);
+
+	ln_get_nutation(JD[0], &nut_again);
+	failed += test_result("(Nutation) cached longitude  ",
+		nut_again.longitude, nut[0].longitude, 0.0);
+	ln_get_nutation(JD[1], &nut_again);
+	failed += test_result("(Nutation) cached longitude  ",
+		nut_again.longitude, nut[1].longitude, 0.0);
+
+	/* within the threshold of the newest epoch it is reused, but not of an
+	 * older one */
+	ln_get_nutation(JD[0], &nut_again);
+	ln_get_nutation(JD[2], &nut_again);
+	failed += test_result("(Nutation) newest epoch reused  ",
+		nut_again.longitude, nut[0].longitude, 0.0);
+
+	ln_get_nutation(JD[1], &nut_again);
+	ln_get_nutation(JD[2], &nut[1]);
+	ln_get_nutation(JD[1], &nut_again);
+	ln_get_nutation(JD[0], &nut_again);
+	failed += test_result("(Nutation) older epoch not reused  ",
+		nut[1].longitude != nut[0].longitude, 1, 0);
+	failed += test_result("(Nutation) alternating epochs  ",
+		nut_again.longitude, nut[0].longitude, 0.0);
+
+	return failed;
+}
+
+/* each thread has its own nutation cache, so alternating epochs in many
+ * threads must give the values of single calls */
+static int nutation_threads_test(void)
+{
+	struct ln_nutation nut[8];
+	double JD[8];
+	int i, errors = 0;
+
+	for (i = 0; i < 8; i++) {
+		JD[i] = 2451545.0 + i * 1.5;
+		ln_get_nutation(JD[i], &nut[i]);
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(4) reduction(+:errors)
+#endif
+	for (i = 0; i < 4000; i++) {
+		struct ln_nutation again;
+		int j = (i * 5 + i / 8) % 8;
+
+		ln_get_nutation(JD[j], &again);
+		if (again.longitude != nut[j].longitude ||
+			again.obliquity != nut[j].obliquity ||
+			again.ecliptic != nut[j].ecliptic)
+			errors++;
+	}
+
+	return test_result("(Nutation) cache in threads  ", errors, 0, 0);
+}
+
+#ifdef LN_CHEB_TEST
+/* the file made by the chebyshev tool at build time holds Earth, Jupiter
+ * and the Moon over JD 2448960.5 to 2448992.5, fitted to 0.001 arcsecs */
+static int chebyshev_file_test(const char *file)
+{
+	struct ln_cheb_ephem *ephem;
+	struct ln_helio_posn pos, cheb;
+	struct ln_rect_posn moon, cheb_moon;
+	double JD, start, end, r, err, worst = 0.0;
+	int i, body, ret = 0, failed = 0;
+
+	ephem = ln_cheb_open(file);
+	failed += test_result("(Chebyshev) open test file  ",
+		ephem != NULL, 1, 0);
+	if (ephem == NULL)
+		return failed;
+
+	ln_cheb_get_span(ephem, &start, &end);
+	failed += test_result("(Chebyshev) test file start  ",
+		start, 2448960.5, 0.0);
+	failed += test_result("(Chebyshev) test file end  ",
+		end, 2448992.5, 0.0);
+
+	/* between the fitting nodes, angular error in arcsecs */
+	for (i = 0; i <= 64; i++) {
+		JD = start + (end - start) * i / 64.0 + (i < 64 ? 0.1234 : 0.0);
+
+		for (body = 0; body < 2; body++) {
+			if (body) {
+				ret |= ln_cheb_get_helio_coords(ephem, LN_BODY_JUPITER,
+					JD, &cheb);
+				ln_get_jupiter_helio_coords(JD, &pos);
+			} else {
+				ret |= ln_cheb_get_helio_coords(ephem, LN_BODY_EARTH,
+					JD, &cheb);
+				ln_get_earth_helio_coords(JD, &pos);
+			}
+
+			err = fmax(fabs(remainder(cheb.L - pos.L, 360.0)) *
+				cos(ln_deg_to_rad(pos.B)), fabs(cheb.B - pos.B)) * 3600.0;
+			err = fmax(err, fabs(cheb.R - pos.R) / pos.R *
+				180.0 * 3600.0 / M_PI);
+			if (err > worst)
+				worst = err;
+		}
+
+		ret |= ln_cheb_get_lunar_geo_posn(ephem, JD, &cheb_moon);
+		ln_get_lunar_geo_posn(JD, &moon, 0.0);
+		r = sqrt(moon.X * moon.X + moon.Y * moon.Y + moon.Z * moon.Z);
+		err = sqrt((cheb_moon.X - moon.X) * (cheb_moon.X - moon.X) +
+			(cheb_moon.Y - moon.Y) * (cheb_moon.Y - moon.Y) +
+			(cheb_moon.Z - moon.Z) * (cheb_moon.Z - moon.Z)) /
+			r * 180.0 * 3600.0 / M_PI;
+		if (err > worst)
+			worst = err;
+	}
+
+	failed += test_result("(Chebyshev) test file positions used  ",
+		ret, 0, 0);
+	failed += test_result("(Chebyshev) test file error arcsecs  ",
+		worst, 0.0, 0.001);
+
+	ret = ln_cheb_get_helio_coords(ephem, LN_BODY_MARS, start, &cheb);
+	failed += test_result("(Chebyshev) Mars not in file falls back  ",
+		ret, 1, 0);
+	ret = ln_cheb_get_helio_coords(ephem, LN_BODY_JUPITER, end + 1.0, &cheb);
+	failed += test_result("(Chebyshev) Jupiter after span falls back  ",
+		ret, 1, 0);
+
+	ln_cheb_close(ephem);
+	return failed;
+}
+#endif
+
+/* without an ephemeris file the series functions must be used */
+static int chebyshev_test(void)
+{
+	struct ln_cheb_ephem *ephem;
+	struct ln_helio_posn pos, cheb;
+	struct ln_rect_posn moon, cheb_moon;
+	double JD = 2448976.5;
+	int ret, failed = 0;
+
+	ephem = ln_cheb_open("/nonexistent/libnova.cheb");
+	failed += test_result("(Chebyshev) open missing file  ",
+		ephem == NULL, 1, 0);
+
+	ret = ln_cheb_get_helio_coords(ephem, LN_BODY_JUPITER, JD, &cheb);
+	ln_get_jupiter_helio_coords(JD, &pos);
+	failed += test_result("(Chebyshev) Jupiter falls back to VSOP87  ",
+		ret, 1, 0);
+	failed += test_result("(Chebyshev) Jupiter fallback L  ",
+		cheb.L, pos.L, 0.0);
+
+	ret = ln_cheb_get_lunar_geo_posn(ephem, JD, &cheb_moon);
+	ln_get_lunar_geo_posn(JD, &moon, 0.0);
+	failed += test_result("(Chebyshev) Moon falls back to ELP  ",
+		ret, 1, 0);
+	failed += test_result("(Chebyshev) Moon fallback X  ",
+		cheb_moon.X, moon.X, 0.0);
+
+	ret = ln_cheb_get_helio_coords(ephem, LN_BODY_MOON, JD, &cheb);
+	failed += test_result("(Chebyshev) Moon is not a planet  ",
+		ret, -1, 0);
+
+#ifdef LN_CHEB_TEST
+	failed += chebyshev_file_test(LN_CHEB_TEST);
+#endif
+	return failed;
+}
+
+/* _ctx functions must match the plain ones exactly */
+static int context_test(void)
+{
+	struct ln_ctx ctx;
+	struct ln_equ_posn equ, equ_ctx;
+	struct ln_hrz_posn hrz, hrz_ctx;
+	struct ln_lnlat_posn observer;
+	double JD = 2448976.5;
+	int failed = 0;
+
+	observer.lng = 282.0;
+	observer.lat = 38.921389;
+
+	ln_ctx_init(&ctx, JD);
+
+	ln_get_mars_equ_coords(JD, &equ);
+	ln_get_mars_equ_coords_ctx(&ctx, &equ_ctx);
+	failed += test_result("(Context) Mars RA  ", equ_ctx.ra, equ.ra, 0.0);
+	failed += test_result("(Context) Mars Dec  ", equ_ctx.dec, equ.dec, 0.0);
+
+	ln_get_hrz_from_equ(&equ, &observer, JD, &hrz);
+	ln_get_hrz_from_equ_ctx(&ctx, &equ, &observer, &hrz_ctx);
+	failed += test_result("(Context) Mars Az  ", hrz_ctx.az, hrz.az, 0.0);
+	failed += test_result("(Context) Mars Alt  ", hrz_ctx.alt, hrz.alt, 0.0);
+
+	failed += test_result("(Context) heliocentric time diff  ",
+		ln_get_heliocentric_time_diff_ctx(&ctx, &equ),
+		ln_get_heliocentric_time_diff(JD, &equ), 0.0);
+
+	ln_get_jupiter_equ_coords(JD, &equ);
+	ln_get_jupiter_equ_coords_ctx(&ctx, &equ_ctx);
+	failed += test_result("(Context) Jupiter RA  ", equ_ctx.ra, equ.ra, 0.0);
+
+	ln_get_solar_equ_coords(JD, &equ);
+	ln_get_solar_equ_coords_ctx(&ctx, &equ_ctx);
+	failed += test_result("(Context) Solar RA  ", equ_ctx.ra, equ.ra, 0.0);
+	failed += test_result("(Context) Solar Dec  ", equ_ctx.dec, equ.dec, 0.0);
+
+	ln_get_lunar_equ_coords(JD, &equ);
+	ln_get_lunar_equ_coords_ctx(&ctx, &equ_ctx);
+	failed += test_result("(Context) Lunar RA  ", equ_ctx.ra, equ.ra, 0.0);
+
+	failed += test_result("(Context) apparent sidereal time  ",
+		ln_get_apparent_sidereal_time_ctx(&ctx),
+		ln_get_apparent_sidereal_time(JD), 0.0);
+
+	/* a new epoch must not reuse the old values */
+	ln_ctx_init(&ctx, JD + 1.0);
+	ln_get_mars_equ_coords(JD + 1.0, &equ);
+	ln_get_mars_equ_coords_ctx(&ctx, &equ_ctx);
+	failed += test_result("(Context) Mars RA next day  ",
+		equ_ctx.ra, equ.ra, 0.0);
+
+	return failed;
+}
+
+/* functions of each planet, NULL where a planet has none */
+#define PLANET(name, p) \
+	{name, ln_get_##p##_helio_coords, ln_get_##p##_equ_coords, \
+	ln_get_##p##_helio_coords_batch, ln_get_##p##_helio_coords_sweep, \
+	ln_get_##p##_helio_coords_prec, ln_get_##p##_helio_posvel, \
+	ln_get_##p##_rect_helio, ln_get_##p##_rect_helio_batch}
+
+static const struct planet_functions {
+	const char *name;
+	void (*helio)(double, struct ln_helio_posn *);
+	void (*equ)(double, struct ln_equ_posn *);
+	void (*batch)(const double *, size_t, struct ln_helio_posn *);
+	void (*sweep)(double, double, size_t, struct ln_helio_posn *);
+	void (*prec)(double, struct ln_helio_posn *, double);
+	void (*posvel)(double, struct ln_helio_posn *, struct ln_helio_posn *);
+	void (*rect)(double, struct ln_rect_posn *);
+	void (*rect_batch)(const double *, size_t, struct ln_rect_posn *);
+} planets[LN_BODY_MOON] = {
+	PLANET("Mercury", mercury),
+	PLANET("Venus", venus),
+	{"Earth", ln_get_earth_helio_coords, NULL,
+		ln_get_earth_helio_coords_batch, ln_get_earth_helio_coords_sweep,
+		ln_get_earth_helio_coords_prec, ln_get_earth_helio_posvel,
+		ln_get_earth_rect_helio, ln_get_earth_rect_helio_batch},
+	PLANET("Mars", mars),
+	PLANET("Jupiter", jupiter),
+	PLANET("Saturn", saturn),
+	PLANET("Uranus", uranus),
+	PLANET("Neptune", neptune),
+	{"Pluto", ln_get_pluto_helio_coords, ln_get_pluto_equ_coords,
+		ln_get_pluto_helio_coords_batch, ln_get_pluto_helio_coords_sweep,
+		NULL, NULL, ln_get_pluto_rect_helio, NULL},
+};
+
+/* largest differences of positions a and b so far in L, B and R */
+static void helio_diff(const struct ln_helio_posn *a,
+	const struct ln_helio_posn *b, double *dL, double *dB, double *dR)
+{
+	*dL = fmax(*dL, fabs(remainder(a->L - b->L, 360.0)));
+	*dB = fmax(*dB, fabs(a->B - b->B));
+	*dR = fmax(*dR, fabs(a->R - b->R));
+}
+
+/* light time by evaluating the planet again for each iteration, as the
+ * _equ_coords functions did before the Taylor series solver */
+static void light_time_loop(double JD,
+	void (*get_helio)(double, struct ln_helio_posn *),
+	struct ln_equ_posn *position)
+{
+	struct ln_helio_posn h_sol, h_planet;
+	struct ln_rect_posn g_sol, g_planet;
+	double a, b, c, delta, diff, last, t = 0;
+
+	ln_get_solar_geom_coords(JD, &h_sol);
+	ln_get_rect_from_helio(&h_sol, &g_sol);
+
+	do {
+		last = t;
+		get_helio(JD - t, &h_planet);
+		ln_get_rect_from_helio(&h_planet, &g_planet);
+
+		a = g_sol.X + g_planet.X;
+		b = g_sol.Y + g_planet.Y;
+		c = g_sol.Z + g_planet.Z;
+
+		delta = sqrt(a * a + b * b + c * c);
+		t = delta * 0.0057755183;
+		diff = t - last;
+	} while (diff > 0.0001 || diff < -0.0001);
+
+	position->ra = ln_range_degrees(ln_rad_to_deg(atan2(b, a)));
+	position->dec = ln_rad_to_deg(asin(c / delta));
+}
+
+/* The batch, sweep, truncated, rectangular and velocity functions of each
+ * planet against its single positions, and its light time against
+ * iterated positions. Truncation errors are printed as a fraction of
+ * precision. Rates are checked against a five point difference with h
+ * exact in binary, rounding in the positions limiting it to about 1e-9
+ * degrees per day. */
+static int planets_test(void)
+{
+	const struct planet_functions *p;
+	struct ln_helio_posn helio[200], pos, vel, near[4];
+	struct ln_rect_posn batch[20], rect, conv;
+	struct ln_equ_posn equ, loop;
+	double JD[200], precision[3] = {1e-4, 1e-6, 1e-8};
+	double light_JD[3] = {2448976.5, 2451545.0, 2460000.25};
+	double rate_JD[3] = {2448976.5, 2451545.0, 2305447.5};
+	double off[4] = {-2.0, -1.0, 1.0, 2.0}, h = 0.125;
+	double dL, dB, dR, dr, db, rate;
+	char test[64];
+	int i, j, k, failed = 0;
+
+	for (k = 0; k < LN_BODY_MOON; k++) {
+		p = &planets[k];
+
+		/* hourly epochs, more than one block of the batch evaluator */
+		for (i = 0; i < 150; i++)
+			JD[i] = 2448976.5 + i / 24.0;
+		p->batch(JD, 150, helio);
+		dL = dB = dR = 0.0;
+		for (i = 0; i < 150; i++) {
+			p->helio(JD[i], &pos);
+			helio_diff(&helio[i], &pos, &dL, &dB, &dR);
+		}
+		sprintf(test, "(VSOP87) %s batch L  ", p->name);
+		failed += test_result(test, dL, 0.0, 0.0000000001);
+		sprintf(test, "(VSOP87) %s batch B  ", p->name);
+		failed += test_result(test, dB, 0.0, 0.0000000001);
+		sprintf(test, "(VSOP87) %s batch R  ", p->name);
+		failed += test_result(test, dR, 0.0, 0.0000000001);
+
+		/* more than three reset intervals of the recurrence */
+		p->sweep(2448976.5, 1.5, 200, helio);
+		dL = dB = dR = 0.0;
+		for (i = 0; i < 200; i++) {
+			p->helio(2448976.5 + i * 1.5, &pos);
+			helio_diff(&helio[i], &pos, &dL, &dB, &dR);
+		}
+		sprintf(test, "(VSOP87) %s sweep L  ", p->name);
+		failed += test_result(test, dL, 0.0, 0.0000000001);
+		sprintf(test, "(VSOP87) %s sweep B  ", p->name);
+		failed += test_result(test, dB, 0.0, 0.0000000001);
+		sprintf(test, "(VSOP87) %s sweep R  ", p->name);
+		failed += test_result(test, dR, 0.0, 0.0000000001);
+
+		/* every 50 years from 1500 AD, direct against converted */
+		for (i = 0; i < 20; i++)
+			JD[i] = 2268923.5 + i * 18262.5;
+		if (p->rect_batch)
+			p->rect_batch(JD, 20, batch);
+		dr = db = 0.0;
+		for (i = 0; i < 20; i++) {
+			p->helio(JD[i], &pos);
+			ln_get_rect_from_helio(&pos, &conv);
+			p->rect(JD[i], &rect);
+			dr = fmax(dr, fabs(rect.X - conv.X));
+			dr = fmax(dr, fabs(rect.Y - conv.Y));
+			dr = fmax(dr, fabs(rect.Z - conv.Z));
+			if (p->rect_batch) {
+				db = fmax(db, fabs(rect.X - batch[i].X));
+				db = fmax(db, fabs(rect.Y - batch[i].Y));
+				db = fmax(db, fabs(rect.Z - batch[i].Z));
+			}
+		}
+		sprintf(test, "(VSOP87) %s rectangular  ", p->name);
+		failed += test_result(test, dr, 0.0, 0.0000000001);
+		if (p->rect_batch) {
+			sprintf(test, "(VSOP87) %s rectangular batch  ", p->name);
+			failed += test_result(test, db, 0.0, 0.0000000001);
+		}
+
+		/* light time from one position and velocity */
+		if (p->equ) {
+			dr = db = 0.0;
+			for (i = 0; i < 3; i++) {
+				p->equ(light_JD[i], &equ);
+				light_time_loop(light_JD[i], p->helio, &loop);
+				dr = fmax(dr, fabs(remainder(equ.ra - loop.ra, 360.0)));
+				db = fmax(db, fabs(equ.dec - loop.dec));
+			}
+			sprintf(test, "(Light time) %s RA  ", p->name);
+			failed += test_result(test, dr, 0.0, 0.000001);
+			sprintf(test, "(Light time) %s Dec  ", p->name);
+			failed += test_result(test, db, 0.0, 0.000001);
+		}
+
+		/* Pluto is not a VSOP87 planet */
+		if (p->prec == NULL)
+			continue;
+
+		/* 1000 AD to 3000 AD */
+		for (j = 0; j < 3; j++) {
+			dL = dB = dR = 0.0;
+			for (i = 0; i <= 40; i++) {
+				JD[0] = 2086302.5 + i * 18262.0;
+				p->helio(JD[0], &pos);
+				p->prec(JD[0], &helio[0], precision[j]);
+				helio_diff(&helio[0], &pos, &dL, &dB, &dR);
+			}
+
+			sprintf(test, "(VSOP87) %s L to %g  ", p->name, precision[j]);
+			failed += test_result(test, ln_deg_to_rad(dL) / precision[j],
+				0.0, 1.0);
+			sprintf(test, "(VSOP87) %s B to %g  ", p->name, precision[j]);
+			failed += test_result(test, ln_deg_to_rad(dB) / precision[j],
+				0.0, 1.0);
+			sprintf(test, "(VSOP87) %s R to %g  ", p->name, precision[j]);
+			failed += test_result(test, dR / precision[j], 0.0, 1.0);
+		}
+
+		/* precision 0 is the full series */
+		p->helio(2448976.5, &pos);
+		p->prec(2448976.5, &helio[0], 0.0);
+		sprintf(test, "(VSOP87) %s full precision L  ", p->name);
+		failed += test_result(test, helio[0].L, pos.L, 0.0);
+
+		/* analytic rates */
+		dL = dB = dR = 0.0;
+		dr = 0.0;
+		for (i = 0; i < 3; i++) {
+			p->posvel(rate_JD[i], &pos, &vel);
+			for (j = 0; j < 4; j++)
+				p->helio(rate_JD[i] + off[j] * h, &near[j]);
+
+			rate = (8.0 * remainder(near[2].L - near[1].L, 360.0) -
+				remainder(near[3].L - near[0].L, 360.0)) / (12.0 * h);
+			dL = fmax(dL, fabs(vel.L - rate));
+			rate = (8.0 * (near[2].B - near[1].B) -
+				(near[3].B - near[0].B)) / (12.0 * h);
+			dB = fmax(dB, fabs(vel.B - rate));
+			rate = (8.0 * (near[2].R - near[1].R) -
+				(near[3].R - near[0].R)) / (12.0 * h);
+			dR = fmax(dR, fabs(vel.R - rate));
+
+			p->helio(rate_JD[i], &near[0]);
+			helio_diff(&pos, &near[0], &dr, &dr, &dr);
+		}
+		sprintf(test, "(VSOP87) %s posvel position  ", p->name);
+		failed += test_result(test, dr, 0.0, 0.0000000001);
+		sprintf(test, "(VSOP87) %s dL/dt  ", p->name);
+		failed += test_result(test, dL, 0.0, 0.00000001);
+		sprintf(test, "(VSOP87) %s dB/dt  ", p->name);
+		failed += test_result(test, dB, 0.0, 0.00000001);
+		sprintf(test, "(VSOP87) %s dR/dt  ", p->name);
+		failed += test_result(test, dR, 0.0, 0.00000001);
+	}
+
+	return failed;
+}
+
+/* snapshot positions must match the single planet functions */
+static int planets_snapshot_test(void)
+{
+	struct ln_planet_snapshot planet[LN_BODY_MOON];
+	struct ln_helio_posn helio;
+	struct ln_equ_posn equ;
+	double JD = 2448976.5, dhelio = 0.0, dequ = 0.0, delta;
+	int i, ret, failed = 0;
+
+	ret = ln_get_planets_snapshot(JD, LN_PLANETS_MASK, planet);
+	failed += test_result("(Snapshot) all planets  ", ret, LN_BODY_MOON, 0);
+
+	for (i = 0; i < LN_BODY_MOON; i++) {
+		planets[i].helio(JD, &helio);
+		dhelio = fmax(dhelio, fabs(remainder(planet[i].helio.L - helio.L,
+			360.0)));
+		dhelio = fmax(dhelio, fabs(planet[i].helio.B - helio.B));
+		dhelio = fmax(dhelio, fabs(planet[i].helio.R - helio.R));
+		if (i == LN_BODY_EARTH)
+			continue;
+
+		planets[i].equ(JD, &equ);
+		dequ = fmax(dequ, fabs(planet[i].equ.ra - equ.ra));
+		dequ = fmax(dequ, fabs(planet[i].equ.dec - equ.dec));
+	}
+
+	failed += test_result("(Snapshot) heliocentric positions  ",
+		dhelio, 0.0, 0.0000000001);
+	failed += test_result("(Snapshot) equatorial positions  ",
+		dequ, 0.0, 0.0000000001);
+
+	/* the planet light time earlier, a few 1e-5 AU from the geometric */
+	delta = sqrt(planet[LN_BODY_MARS].geo.X * planet[LN_BODY_MARS].geo.X +
+		planet[LN_BODY_MARS].geo.Y * planet[LN_BODY_MARS].geo.Y +
+		planet[LN_BODY_MARS].geo.Z * planet[LN_BODY_MARS].geo.Z);
+	failed += test_result("(Snapshot) Mars distance  ", delta,
+		ln_get_mars_earth_dist(JD), 0.0001);
+
+	ret = ln_get_planets_snapshot(JD, LN_BODY_MASK(LN_BODY_JUPITER) |
+		LN_BODY_MASK(LN_BODY_PLUTO), planet);
+	failed += test_result("(Snapshot) two planets  ", ret, 2, 0);
+
+	ret = ln_get_planets_snapshot(JD, LN_BODY_MASK(LN_BODY_MOON), planet);
+	failed += test_result("(Snapshot) Moon is not a planet  ", ret, -1, 0);
+
+	return failed;
+}
+
+/* lunar longitude, latitude and distance of a geocentric position */
+static void lunar_polar(const struct ln_rect_posn *moon, double *lng,
+	double *lat, double *dist)
+{
+	*dist = sqrt(moon->X * moon->X + moon->Y * moon->Y + moon->Z * moon->Z);
+	*lng = atan2(moon->Y, moon->X);
+	*lat = asin(moon->Z / *dist);
+}
+
+/* truncated ELP series must stay within precision of the full series,
+ * errors are printed as a fraction of precision */
+static int lunar_prec_test(void)
+{
+	struct ln_rect_posn full, part;
+	double precision[5] = {1e-4, 1e-5, 1e-6, 1e-7, 1e-9};
+	double JD, lng, lat, dist, flng, flat, fdist, dL, dB, dR;
+	char test[64];
+	int i, j, failed = 0;
+
+	for (j = 0; j < 5; j++) {
+		dL = dB = dR = 0.0;
+
+		/* 1900 to 2100 and J2000 itself, where t is 0 */
+		for (i = 0; i <= 41; i++) {
+			JD = i < 41 ? 2415020.5 + i * 1826.2 : 2451545.0;
+			ln_get_lunar_geo_posn(JD, &full, 0.0);
+			ln_get_lunar_geo_posn(JD, &part, precision[j]);
+			lunar_polar(&full, &flng, &flat, &fdist);
+			lunar_polar(&part, &lng, &lat, &dist);
+
+			dL = fmax(dL, fabs(remainder(lng - flng, 2.0 * M_PI)));
+			dB = fmax(dB, fabs(lat - flat));
+			dR = fmax(dR, fabs(dist - fdist));
+		}
+
+		/* the series are to the ecliptic of date, Laskar's rotation to
+		 * J2000 mixes longitude and latitude by a few arcsecs a century */
+		sprintf(test, "(ELP) Moon L to %g  ", precision[j]);
+		failed += test_result(test, dL / precision[j], 0.0, 1.01);
+		sprintf(test, "(ELP) Moon B to %g  ", precision[j]);
+		failed += test_result(test, dB / precision[j], 0.0, 1.01);
+		sprintf(test, "(ELP) Moon R to %g  ", precision[j]);
+		failed += test_result(test, dR / precision[j], 0.0, 1.0);
+	}
+
+	return failed;
+}
+
+/* lunar positions shared among threads must be the same to the bit */
+static int lunar_threads_test(void)
+{
+	struct ln_rect_posn single[3], shared;
+	double JD[3] = {2448724.5, 2415020.5, 2488069.5};
+	char test[64];
+	int i, threads, failed = 0;
+
+	for (i = 0; i < 3; i++)
+		ln_get_lunar_geo_posn(JD[i], &single[i], 0.0);
+
+	threads = ln_set_lunar_threads(4);
+	fprintf(stdout, "(ELP) Moon shared among %d threads\n", threads);
+
+	for (i = 0; i < 3; i++) {
+		ln_get_lunar_geo_posn(JD[i], &shared, 0.0);
+		sprintf(test, "(ELP) Moon threads X at %.1f  ", JD[i]);
+		failed += test_result(test, shared.X, single[i].X, 0.0);
+		sprintf(test, "(ELP) Moon threads Y at %.1f  ", JD[i]);
+		failed += test_result(test, shared.Y, single[i].Y, 0.0);
+		sprintf(test, "(ELP) Moon threads Z at %.1f  ", JD[i]);
+		failed += test_result(test, shared.Z, single[i].Z, 0.0);
+	}
+
+	ln_set_lunar_threads(1);
+	return failed;
+}
+
+/* the batch lunar positions against single calls */
+static int lunar_batch_test(void)
+{
+	struct ln_rect_posn batch[150], pos;
+	double JD[150], precision[2] = {0.0, 1e-6}, dX;
+	char test[64];
+	int i, j, failed = 0;
+
+	/* two days apart over 300 days and then 200 years */
+	for (i = 0; i < 150; i++)
+		JD[i] = i < 100 ? 2451545.0 + i * 3.0 : 2415020.5 + i * 1461.0;
+
+	for (j = 0; j < 2; j++) {
+		ln_get_lunar_geo_posn_batch(JD, 150, batch, precision[j]);
+
+		dX = 0.0;
+		for (i = 0; i < 150; i++) {
+			ln_get_lunar_geo_posn(JD[i], &pos, precision[j]);
+			dX = fmax(dX, fabs(batch[i].X - pos.X));
+			dX = fmax(dX, fabs(batch[i].Y - pos.Y));
+			dX = fmax(dX, fabs(batch[i].Z - pos.Z));
+		}
+
+		/* a block may sum more terms than a single call */
+		sprintf(test, "(ELP) Moon batch to %g XYZ  ", precision[j]);
+		failed += test_result(test, dX, 0.0,
+			precision[j] > 0.0 ? 2.0 * precision[j] * 384400.0 : 1e-8);
+	}
+
+	return failed;
+}
+
+/* Richardson extrapolated central difference of lunar positions about JD,
+ * good to about 1e-3 km a day against the 1e-5 km noise of a position */
+static void lunar_difference(double JD, struct ln_rect_posn *rate)
+{
+	struct ln_rect_posn p[4];
+	double h = 0.02;
+
+	ln_get_lunar_geo_posn(JD - h, &p[0], 0.0);
+	ln_get_lunar_geo_posn(JD + h, &p[1], 0.0);
+	ln_get_lunar_geo_posn(JD - h / 2.0, &p[2], 0.0);
+	ln_get_lunar_geo_posn(JD + h / 2.0, &p[3], 0.0);
+
+	rate->X = (4.0 * (p[3].X - p[2].X) / h -
+		(p[1].X - p[0].X) / (2.0 * h)) / 3.0;
+	rate->Y = (4.0 * (p[3].Y - p[2].Y) / h -
+		(p[1].Y - p[0].Y) / (2.0 * h)) / 3.0;
+	rate->Z = (4.0 * (p[3].Z - p[2].Z) / h -
+		(p[1].Z - p[0].Z) / (2.0 * h)) / 3.0;
+}
+
+/* the analytic lunar velocity against differences of positions */
+static int lunar_posvel_test(void)
+{
+	struct ln_rect_posn pos, vel, diff;
+	double JD[3] = {2448724.5, 2415020.5, 2488069.5};
+	char test[64];
+	int i, failed = 0;
+
+	for (i = 0; i < 3; i++) {
+		ln_get_lunar_geo_posvel(JD[i], &pos, &vel, 0.0);
+		lunar_difference(JD[i], &diff);
+
+		sprintf(test, "(ELP) Moon velocity X at %.1f  ", JD[i]);
+		failed += test_result(test, vel.X, diff.X, 0.005);
+		sprintf(test, "(ELP) Moon velocity Y at %.1f  ", JD[i]);
+		failed += test_result(test, vel.Y, diff.Y, 0.005);
+		sprintf(test, "(ELP) Moon velocity Z at %.1f  ", JD[i]);
+		failed += test_result(test, vel.Z, diff.Z, 0.005);
+
+		ln_get_lunar_geo_posn(JD[i], &diff, 0.0);
+		sprintf(test, "(ELP) Moon posvel X at %.1f  ", JD[i]);
+		failed += test_result(test, pos.X, diff.X, 1e-8);
+	}
+
+	return failed;
+}
+
+/* the abridged lunar theory against ELP, its rise and set times and a
+ * new moon of Meeus example 49.a */
+static int lunar_fast_test(void)
+{
+	struct ln_rect_posn full, fast;
+	struct ln_lnlat_posn observer;
+	struct ln_rst_time rfull, rfast;
+	double JD, lng, lat, dist, flng, flat, fdist, dL = 0.0, dB = 0.0;
+	double dR = 0.0;
+	int i, failed = 0;
+
+	/* 1900 to 2100 every 401 days */
+	for (i = 0; i < 183; i++) {
+		JD = 2415020.5 + i * 401.0;
+		ln_get_lunar_geo_posn(JD, &full, 0.0);
+		ln_get_lunar_geo_posn_fast(JD, &fast);
+		lunar_polar(&full, &flng, &flat, &fdist);
+		lunar_polar(&fast, &lng, &lat, &dist);
+
+		dL = fmax(dL, fabs(remainder(lng - flng, 2.0 * M_PI)));
+		dB = fmax(dB, fabs(lat - flat));
+		dR = fmax(dR, fabs(dist - fdist));
+	}
+
+	failed += test_result("(Lunar) fast longitude arcsecs  ",
+		ln_rad_to_deg(dL) * 3600.0, 0.0, 15.0);
+	failed += test_result("(Lunar) fast latitude arcsecs  ",
+		ln_rad_to_deg(dB) * 3600.0, 0.0, 5.0);
+	failed += test_result("(Lunar) fast distance km  ", dR, 0.0, 25.0);
+
+	/* rise, set and transit by the full and abridged theories */
+	observer.lng = 15;
+	observer.lat = 51;
+	ln_get_body_rst_horizon(2453752.5, &observer, ln_get_lunar_equ_coords,
+		LN_LUNAR_STANDART_HORIZON, &rfull);
+	ln_get_lunar_rst(2453752.5, &observer, &rfast);
+	failed += test_result("(Lunar) fast rise secs  ",
+		(rfast.rise - rfull.rise) * 86400.0, 0.0, 5.0);
+	failed += test_result("(Lunar) fast set secs  ",
+		(rfast.set - rfull.set) * 86400.0, 0.0, 5.0);
+	failed += test_result("(Lunar) fast transit secs  ",
+		(rfast.transit - rfull.transit) * 86400.0, 0.0, 5.0);
+
+	/* 1977 February 18 3h 37m 40s TD */
+	failed += test_result("(Lunar) new moon, Meeus example 49.a  ",
+		ln_lunar_next_phase(2443190.0, 0.0), 2443192.65118, 0.0001);
+
+	return failed;
+}
+
+/* a calendar of lunar phases against the examples of Meeus and the
+ * searches of single phases, then shared among threads */
+static int lunar_phases_test(void)
+{
+	struct ln_lunar_phase phases[130], shared[130];
+	double JD, dt = 0.0, gap = 100.0;
+	int i, n, threads, order = 0, failed = 0;
+
+	/* 1977 February 18 3h 37m 40s TD */
+	n = ln_lunar_phases_in_range(2443190.0, 2443200.0, LN_LUNAR_NEW_MOON,
+		phases, 1);
+	failed += test_result("(Lunar) phases, Meeus example 49.a count  ",
+		n, 1, 0);
+	failed += test_result("(Lunar) phases, Meeus example 49.a  ",
+		phases[0].JD, 2443192.65118, 0.0001);
+
+	/* 2044 January 21 23h 48m 17s TD */
+	n = ln_lunar_phases_in_range(2467616.5, 2467647.5,
+		LN_LUNAR_LAST_QUARTER, phases, 130);
+	failed += test_result("(Lunar) phases, Meeus example 49.b count  ",
+		n, 1, 0);
+	failed += test_result("(Lunar) phases, Meeus example 49.b  ",
+		phases[0].JD, 2467636.49186, 0.0001);
+
+	/* 2000 to 2002, each phase once in order and as found singly */
+	n = ln_lunar_phases_in_range(2451544.5, 2452275.5, LN_LUNAR_ALL_PHASES,
+		phases, 130);
+	failed += test_result("(Lunar) phases 2000 - 2001 count  ", n, 99, 0);
+
+	for (i = 0; i < n; i++) {
+		JD = ln_lunar_next_phase(phases[i].JD - 1.0, phases[i].phase);
+		dt = fmax(dt, fabs(JD - phases[i].JD));
+		if (i > 0) {
+			gap = fmin(gap, phases[i].JD - phases[i - 1].JD);
+			order += fmod(phases[i].phase - phases[i - 1].phase + 1.0,
+				1.0) != 0.25;
+		}
+	}
+	failed += test_result("(Lunar) phases in order  ", order, 0, 0);
+	failed += test_result("(Lunar) phases shortest quarter days  ",
+		gap > 6.0, 1, 0);
+	failed += test_result("(Lunar) phases against next phase secs  ",
+		dt * 86400.0, 0.0, 1.0);
+
+	/* a full array stops the search */
+	failed += test_result("(Lunar) phases stop at max  ",
+		ln_lunar_phases_in_range(2451544.5, 2452275.5,
+			LN_LUNAR_ALL_PHASES, shared, 5), 5, 0);
+	failed += test_result("(Lunar) phases first of max  ",
+		shared[4].JD, phases[4].JD, 0.0);
+
+	threads = ln_set_lunar_threads(4);
+	fprintf(stdout, "(Lunar) phases shared among %d threads\n", threads);
+	n = ln_lunar_phases_in_range(2451544.5, 2452275.5, LN_LUNAR_ALL_PHASES,
+		shared, 130);
+	ln_set_lunar_threads(1);
+
+	failed += test_result("(Lunar) phases threads count  ", n, 99, 0);
+	for (i = 0, dt = 0.0; i < n; i++)
+		dt = fmax(dt, fabs(shared[i].JD - phases[i].JD));
+	failed += test_result("(Lunar) phases threads  ", dt, 0.0, 0.0);
+
+	return failed;
+}
+
+/* topocentric Moon for a grid of observers against ln_get_parallax() and
+ * ln_get_hrz_from_equ_sidereal_time() */
+static int lunar_topo_test(void)
+{
+	struct ln_observer observers[91];
+	struct ln_topo_posn topo[91];
+	struct ln_lunar_state state;
+	struct ln_equ_posn equ, parallax;
+	struct ln_hrz_posn hrz;
+	double JD = 2448724.5, sidereal, dra = 0.0, ddec = 0.0, daz = 0.0;
+	double dalt = 0.0, ddist = 0.0, dist, p_sin_o, p_cos_o, H, dec, x, y, z;
+	int i, failed = 0;
+
+	/* latitudes from -80 to 80 and longitudes all round, up to 4 km */
+	for (i = 0; i < 91; i++) {
+		observers[i].posn.lat = -80.0 + (i % 17) * 10.0;
+		observers[i].posn.lng = -180.0 + i * 37.0;
+		observers[i].height = (i % 5) * 1000.0;
+	}
+
+	ln_get_lunar_state(JD, &state);
+	ln_get_lunar_topo_coords(JD, &state, observers, 91, topo);
+	sidereal = ln_get_apparent_sidereal_time(JD);
+
+	for (i = 0; i < 91; i++) {
+		ln_get_parallax(&state.equ, state.dist / 149597870.0,
+			&observers[i].posn, observers[i].height, JD, &parallax);
+		equ.ra = state.equ.ra + parallax.ra;
+		equ.dec = state.equ.dec + parallax.dec;
+		ln_get_hrz_from_equ_sidereal_time(&equ, &observers[i].posn,
+			sidereal, &hrz);
+
+		dra = fmax(dra, fabs(remainder(topo[i].equ.ra - equ.ra, 360.0)));
+		ddec = fmax(ddec, fabs(topo[i].equ.dec - equ.dec));
+		daz = fmax(daz, fabs(remainder(topo[i].hrz.az - hrz.az, 360.0)));
+		dalt = fmax(dalt, fabs(topo[i].hrz.alt - hrz.alt));
+
+		/* the geocentric Moon less the observer on the ellipsoid */
+		ln_get_earth_centre_dist(observers[i].height,
+			observers[i].posn.lat, &p_sin_o, &p_cos_o);
+		H = ln_deg_to_rad(sidereal * 15.0 + observers[i].posn.lng -
+			state.equ.ra);
+		dec = ln_deg_to_rad(state.equ.dec);
+		x = state.dist * cos(dec) * cos(H) - 6378.14 * p_cos_o;
+		y = state.dist * cos(dec) * sin(H);
+		z = state.dist * sin(dec) - 6378.14 * p_sin_o;
+		dist = sqrt(x * x + y * y + z * z);
+		ddist = fmax(ddist, fabs(topo[i].dist - dist));
+	}
+
+	failed += test_result("(Lunar) topocentric RA arcsecs  ", dra * 3600.0,
+		0.0, 0.5);
+	failed += test_result("(Lunar) topocentric Dec arcsecs  ",
+		ddec * 3600.0, 0.0, 0.5);
+	failed += test_result("(Lunar) topocentric az arcsecs  ", daz * 3600.0,
+		0.0, 1.0);
+	failed += test_result("(Lunar) topocentric alt arcsecs  ",
+		dalt * 3600.0, 0.0, 0.5);
+	failed += test_result("(Lunar) topocentric distance km  ", ddist,
+		0.0, 0.001);
+
+	return failed;
+}
+
+/* the lunar state against the functions it replaces */
+static int lunar_state_test(void)
+{
+	struct ln_lunar_state state;
+	struct ln_rect_posn rect;
+	struct ln_lnlat_posn ecl;
+	struct ln_equ_posn equ;
+	double JD = 2448724.5;
+	int failed = 0;
+
+	ln_get_lunar_state(JD, &state);
+	ln_get_lunar_geo_posn(JD, &rect, 0.0);
+	ln_get_lunar_ecl_coords(JD, &ecl, 0.0);
+	ln_get_lunar_equ_coords(JD, &equ);
+
+	failed += test_result("(Lunar) state X  ", state.rect.X, rect.X, 0.0);
+	failed += test_result("(Lunar) state Z  ", state.rect.Z, rect.Z, 0.0);
+	failed += test_result("(Lunar) state long  ", state.ecl.lng, ecl.lng,
+		1e-9);
+	failed += test_result("(Lunar) state lat  ", state.ecl.lat, ecl.lat,
+		1e-9);
+	failed += test_result("(Lunar) state RA  ", state.equ.ra, equ.ra, 1e-9);
+	failed += test_result("(Lunar) state Dec  ", state.equ.dec, equ.dec,
+		1e-9);
+
+	/* the functions truncate the series to 1e-4 and 1e-5 */
+	failed += test_result("(Lunar) state distance  ", state.dist,
+		ln_get_lunar_earth_dist(JD), 1e-4);
+	failed += test_result("(Lunar) state phase  ", state.phase,
+		ln_get_lunar_phase(JD), 0.01);
+	failed += test_result("(Lunar) state disk  ", state.disk,
+		ln_get_lunar_disk(JD), 1e-4);
+	failed += test_result("(Lunar) state bright limb  ", state.bright_limb,
+		ln_get_lunar_bright_limb(JD), 1e-9);
+	failed += test_result("(Lunar) state sdiam  ", state.sdiam,
+		ln_get_lunar_sdiam(JD), 1e-6);
+
+	return failed;
+}
+
+/* the single precision series against the double precision path over
+ * 200 and 2000 years about J2000, within the documented bounds */
+static int float_series_test(void)
+{
+	static char *names[2][3] = {
+		{"(Float) planet L and B 1900 - 2100  ",
+		 "(Float) planet R 1900 - 2100  ",
+		 "(Float) Moon 1900 - 2100  "},
+		{"(Float) planet L and B 1000 - 3000  ",
+		 "(Float) planet R 1000 - 3000  ",
+		 "(Float) Moon 1000 - 3000  "},
+	};
+	/* arcsecs, parts of R and km */
+	static const double tolerance[2][3] = {
+		{0.01, 1.5e-7, 0.001},
+		{0.15, 1.5e-6, 0.05},
+	};
+	struct ln_helio_posn helio, helio_float;
+	struct ln_rect_posn moon, moon_float;
+	double JD, span[2] = {36525.0, 365250.0}, error[3], dX, dY, dZ;
+	int i, j, k, failed = 0;
+
+	for (k = 0; k < 2; k++) {
+		error[0] = error[1] = error[2] = 0.0;
+
+		for (j = 0; j <= 20; j++) {
+			JD = 2451545.3 + span[k] * (j / 10.0 - 1.0);
+
+			for (i = 0; i < LN_BODY_PLUTO; i++) {
+				planets[i].helio(JD, &helio);
+				ln_get_planet_helio_coords_float(i, JD, &helio_float);
+				error[0] = fmax(error[0], fabs(remainder(helio.L -
+					helio_float.L, 360.0)) * 3600.0);
+				error[0] = fmax(error[0],
+					fabs(helio.B - helio_float.B) * 3600.0);
+				error[1] = fmax(error[1],
+					fabs(helio.R - helio_float.R) / helio.R);
+			}
+
+			ln_get_lunar_geo_posn(JD, &moon, 0.0);
+			ln_get_lunar_geo_posn_float(JD, &moon_float);
+			dX = moon.X - moon_float.X;
+			dY = moon.Y - moon_float.Y;
+			dZ = moon.Z - moon_float.Z;
+			error[2] = fmax(error[2], sqrt(dX * dX + dY * dY + dZ * dZ));
+		}
+
+		for (i = 0; i < 3; i++)
+			failed += test_result(names[k][i], error[i], 0.0,
+				tolerance[k][i]);
+	}
+
+	failed += test_result("(Float) Pluto is not a VSOP87 planet  ",
+		ln_get_planet_helio_coords_float(LN_BODY_PLUTO, JD,
+		&helio_float), -1, 0);
+
+	return failed;
+}
+
 int lunar_test ()
 {
 	double JD = 2448724.5;
@@ -1893,7 +2920,7 @@ static int parallax_test(void)
   	struct ln_lnlat_posn observer;
 	struct ln_dms dms;
 	struct ln_date date;
-	double jd;
+	double jd, p_sin_o, p_cos_o;
 	int failed = 0;
 
 	dms.neg = 0;
@@ -1922,14 +2949,22 @@ static int parallax_test(void)
 
 	ln_get_mars_equ_coords(jd, &mars);
 
+	/* Meeus example 11.a */
+	ln_get_earth_centre_dist(1706, observer.lat, &p_sin_o, &p_cos_o);
+	failed += test_result("Palomar observatory p sin o  ", p_sin_o,
+		0.546861, 0.000001);
+	failed += test_result("Palomar observatory p cos o  ", p_cos_o,
+		0.836339, 0.000001);
+
 	ln_get_parallax(&mars, ln_get_mars_earth_dist(jd),
 			&observer, 1706, jd, &parallax);
 
-	/* parallax is hard to calculate, so we allow relatively big error */
+	/* Meeus example 40.a gives +1.29 secs and -14.1 arcsecs, from a
+	 * slightly different geocentric position of Mars */
 	failed += test_result("Mars RA parallax for Palomar observatory at "
-		"2003/08/28 3:17 UT  ", parallax.ra, 0.003552, 0.00001);
+		"2003/08/28 3:17 UT  ", parallax.ra, 1.29 / 240.0, 0.00002);
 	failed += test_result("Mars DEC parallax for Palomar observatory at "
-		"2003/08/28 3:17 UT  ", parallax.dec, -20.01 / 3600.0, 0.00002);
+		"2003/08/28 3:17 UT  ", parallax.dec, -14.1 / 3600.0, 0.00002);
 
 	return failed;
 }
@@ -2061,10 +3096,124 @@ static int constellation_test(void)
 	return failed;
 }
 
+/* time since bench_start() in usecs a call over calls calls */
+static struct timeval bench;
+
+static void bench_start(void)
+{
+	gettimeofday(&bench, NULL);
+}
+
+static double bench_usecs(int calls)
+{
+	struct timeval now;
+
+	gettimeofday(&now, NULL);
+	return ((now.tv_sec - bench.tv_sec) * 1000000.0 +
+		(now.tv_usec - bench.tv_usec)) / calls;
+}
+
+/* times of the lunar functions against the ways they replace, run by
+ * lntest -b instead of the tests */
+static void lunar_benchmarks(void)
+{
+	struct ln_lunar_phase phases[130];
+	struct ln_observer observers[91];
+	struct ln_topo_posn topo[91];
+	struct ln_lunar_state state;
+	struct ln_rect_posn moon[150];
+	struct ln_equ_posn equ, parallax;
+	double JD[150], precision[6] = {1e-4, 1e-5, 1e-6, 1e-7, 1e-9, 0.0};
+	int i, j, n;
+
+	for (j = 0; j < 6; j++) {
+		bench_start();
+		for (i = 0; i < 1000; i++)
+			ln_get_lunar_geo_posn(2451545.0 + i * 0.37, &moon[0],
+				precision[j]);
+		fprintf(stdout, "(ELP) Moon to %g: %.1f usecs a position\n",
+			precision[j], bench_usecs(1000));
+	}
+
+	for (i = 0; i < 150; i++)
+		JD[i] = i < 100 ? 2451545.0 + i * 3.0 : 2415020.5 + i * 1461.0;
+	bench_start();
+	for (i = 0; i < 150; i++)
+		ln_get_lunar_geo_posn(JD[i], &moon[i], 0.0);
+	fprintf(stdout, "(ELP) Moon single %.1f usecs a position\n",
+		bench_usecs(150));
+	bench_start();
+	ln_get_lunar_geo_posn_batch(JD, 150, moon, 0.0);
+	fprintf(stdout, "(ELP) Moon batch %.1f usecs a position\n",
+		bench_usecs(150));
+
+	bench_start();
+	for (i = 0; i < 100; i++)
+		ln_get_lunar_geo_posn_fast(2451545.0 + i, &moon[i]);
+	fprintf(stdout, "(Lunar) fast %.2f usecs a position\n",
+		bench_usecs(100));
+
+	bench_start();
+	for (i = 0; i < 20; i++) {
+		ln_get_lunar_equ_coords(2448724.5 + i, &equ);
+		ln_get_lunar_phase(2448724.5 + i);
+		ln_get_lunar_disk(2448724.5 + i);
+		ln_get_lunar_bright_limb(2448724.5 + i);
+		ln_get_lunar_sdiam(2448724.5 + i);
+	}
+	fprintf(stdout, "(Lunar) separate functions %.1f usecs\n",
+		bench_usecs(20));
+	bench_start();
+	for (i = 0; i < 20; i++)
+		ln_get_lunar_state(2448724.5 + i, &state);
+	fprintf(stdout, "(Lunar) state %.1f usecs\n", bench_usecs(20));
+
+	bench_start();
+	n = ln_lunar_phases_in_range(2451544.5, 2452275.5, LN_LUNAR_ALL_PHASES,
+		phases, 130);
+	fprintf(stdout, "(Lunar) phases in range %.0f usecs a phase\n",
+		bench_usecs(n));
+	bench_start();
+	for (i = 0; i < n; i++)
+		ln_lunar_next_phase(phases[i].JD - 1.0, phases[i].phase);
+	fprintf(stdout, "(Lunar) next phase %.0f usecs a phase\n",
+		bench_usecs(n));
+
+	for (i = 0; i < 91; i++) {
+		observers[i].posn.lat = -80.0 + (i % 17) * 10.0;
+		observers[i].posn.lng = -180.0 + i * 37.0;
+		observers[i].height = (i % 5) * 1000.0;
+	}
+	bench_start();
+	for (i = 0; i < 91; i++) {
+		ln_get_lunar_equ_coords(2448724.5, &equ);
+		ln_get_parallax(&equ, ln_get_lunar_earth_dist(2448724.5) /
+			149597870.0, &observers[i].posn, observers[i].height,
+			2448724.5, &parallax);
+	}
+	fprintf(stdout, "(Lunar) topocentric singly %.1f usecs an observer\n",
+		bench_usecs(91));
+	bench_start();
+	ln_get_lunar_state(2448724.5, &state);
+	ln_get_lunar_topo_coords(2448724.5, &state, observers, 91, topo);
+	fprintf(stdout, "(Lunar) topocentric from one state %.1f usecs an "
+		"observer\n", bench_usecs(91));
+}
+
 int main(int argc, const char *argv[])
 {
 	int failed = 0;
-	
+
+#ifdef LN_TEST_DATA
+	/* the series data file of this build, before it is installed */
+	setenv("LIBNOVA_DATA", LN_TEST_DATA, 0);
+#endif
+
+	if (argc > 1 && !strcmp(argv[1], "-b")) {
+		lunar_benchmarks();
+		return 0;
+	}
+
 	start_timer();
 
 	failed += julian_test();
@@ -2079,6 +3228,23 @@ int main(int argc, const char *argv[])
 	failed += precession_test();
 	failed += apparent_position_test ();
 	failed += vsop87_test();
+	failed += vsop87_series_test();
+	failed += vsop87_sweep_test();
+	failed += vsop87_cache_test();
+	failed += nutation_threads_test();
+	failed += chebyshev_test();
+	failed += context_test();
+	failed += planets_test();
+	failed += planets_snapshot_test();
+	failed += float_series_test();
+	failed += lunar_prec_test();
+	failed += lunar_threads_test();
+	failed += lunar_batch_test();
+	failed += lunar_posvel_test();
+	failed += lunar_state_test();
+	failed += lunar_fast_test();
+	failed += lunar_phases_test();
+	failed += lunar_topo_test();
 	failed += lunar_test ();
 	failed += elliptic_motion_test();
 	failed += parabolic_motion_test ();
@@ -0,0 +1,58 @@
+#ifndef	LIBNOVA_CACHEPRIV_H
+#define	LIBNOVA_CACHEPRIV_H
+
+#include <libnova/ln_types.h>
+
+/* Position caches are per thread so the library can be called from many
+ * threads at once without locking. */
+#if defined(_MSC_VER)
+#define LN_THREAD_LOCAL	__declspec(thread)
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L && \
+	!defined(__STDC_NO_THREADS__)
+#define LN_THREAD_LOCAL	_Thread_local
+#else
+#define LN_THREAD_LOCAL	__thread
+#endif
+
+/* recent epochs remembered by each cache */
+#define LN_CACHE_ENTRIES	8
+
+/* heliocentric positions for the last few JDs */
+struct helio_cache
+{
+	double JD[LN_CACHE_ENTRIES];
+	struct ln_helio_posn posn[LN_CACHE_ENTRIES];
+	int valid;	/* entries in use */
+	int next;	/* entry to replace next */
+};
+
+/* copy cached position for JD, returns 0 on a hit */
+static inline int helio_cache_get(const struct helio_cache *cache, double JD,
+	struct ln_helio_posn *position)
+{
+	int i;
+
+	for (i = 0; i < cache->valid; i++) {
+		if (cache->JD[i] == JD) {
+			*position = cache->posn[i];
+			return 0;
+		}
+	}
+
+	return -1;
+}
+
+/* save position for JD, replacing the oldest entry */
+static inline void helio_cache_put(struct helio_cache *cache, double JD,
+	const struct ln_helio_posn *position)
+{
+	cache->JD[cache->next] = JD;
+	cache->posn[cache->next] = *position;
+
+	if (cache->valid < LN_CACHE_ENTRIES)
+		cache->valid++;
+	if (++cache->next == LN_CACHE_ENTRIES)
+		cache->next = 0;
+}
+
+#endif	/* LIBNOVA_CACHEPRIV_H */
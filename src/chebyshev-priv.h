@@ -0,0 +1,41 @@
+#ifndef	LIBNOVA_CHEBYSHEVPRIV_H
+#define	LIBNOVA_CHEBYSHEVPRIV_H
+
+#include <stdint.h>
+
+/* Chebyshev ephemeris file layout, in the byte order of the machine that
+ * wrote it.
+ *
+ *   struct cheb_header
+ *   struct cheb_body [bodies]
+ *   double coefficients
+ *
+ * The coefficients of a body are stored granule by granule, each granule
+ * holding coeffs coefficients for each of the 3 coordinates. Planets store
+ * heliocentric L (degrees, unwrapped within the granule), B (degrees) and
+ * R (AU), the Moon stores geocentric X, Y and Z (km).
+ */
+
+#define CHEB_MAGIC		"LNCHEB1"
+#define CHEB_BYTE_ORDER		0x01020304
+#define CHEB_MAX_COEFFS		32
+
+struct cheb_header
+{
+	char magic[8];
+	uint32_t byte_order;
+	uint32_t bodies;
+	double start_JD;
+	double end_JD;
+};
+
+struct cheb_body
+{
+	uint32_t body;		/* LN_BODY_ */
+	uint32_t coeffs;	/* coefficients per coordinate */
+	uint64_t granules;	/* number of granules */
+	uint64_t offset;	/* file offset of coefficients in bytes */
+	double granule;		/* granule length in days */
+};
+
+#endif	/* LIBNOVA_CHEBYSHEVPRIV_H */
@@ -0,0 +1,311 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <libnova/chebyshev.h>
+#include <libnova/mercury.h>
+#include <libnova/venus.h>
+#include <libnova/earth.h>
+#include <libnova/mars.h>
+#include <libnova/jupiter.h>
+#include <libnova/saturn.h>
+#include <libnova/uranus.h>
+#include <libnova/neptune.h>
+#include <libnova/pluto.h>
+#include <libnova/lunar.h>
+#include <libnova/utility.h>
+#include "chebyshev-priv.h"
+
+#include "config.h"
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#define USE_MMAP
+#endif
+
+struct ln_cheb_ephem
+{
+	void *data;		/* file contents */
+	size_t size;		/* file size in bytes */
+	int mapped;		/* data is mmap()ed */
+	double start_JD;
+	double end_JD;
+	const struct cheb_body *body[LN_BODIES];
+	const double *coeffs[LN_BODIES];
+};
+
+/* series path for each planet, used outside the span of the file */
+static void (*const get_helio_coords[LN_BODY_MOON])(double JD,
+	struct ln_helio_posn *position) = {
+	ln_get_mercury_helio_coords,
+	ln_get_venus_helio_coords,
+	ln_get_earth_helio_coords,
+	ln_get_mars_helio_coords,
+	ln_get_jupiter_helio_coords,
+	ln_get_saturn_helio_coords,
+	ln_get_uranus_helio_coords,
+	ln_get_neptune_helio_coords,
+	ln_get_pluto_helio_coords,
+};
+
+/* read the file, mapping it if we can */
+static int load_file(struct ln_cheb_ephem *ephem, const char *file)
+{
+#ifdef USE_MMAP
+	struct stat st;
+	int fd;
+
+	fd = open(file, O_RDONLY);
+	if (fd < 0)
+		return -1;
+
+	if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+		close(fd);
+		return -1;
+	}
+
+	ephem->size = st.st_size;
+	ephem->data = mmap(NULL, ephem->size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ephem->data == MAP_FAILED) {
+		ephem->data = NULL;
+		return -1;
+	}
+
+	ephem->mapped = 1;
+	return 0;
+#else
+	FILE *fp;
+	long size;
+
+	fp = fopen(file, "rb");
+	if (fp == NULL)
+		return -1;
+
+	if (fseek(fp, 0, SEEK_END) < 0 || (size = ftell(fp)) <= 0 ||
+		fseek(fp, 0, SEEK_SET) < 0) {
+		fclose(fp);
+		return -1;
+	}
+
+	ephem->size = size;
+	ephem->data = malloc(ephem->size);
+	if (ephem->data == NULL ||
+		fread(ephem->data, 1, ephem->size, fp) != ephem->size) {
+		fclose(fp);
+		return -1;
+	}
+
+	fclose(fp);
+	return 0;
+#endif
+}
+
+/*! \fn struct ln_cheb_ephem *ln_cheb_open(const char *file)
+* \param file Chebyshev ephemeris file name
+* \return Ephemeris or NULL if the file could not be read or is not valid.
+*
+* Load a Chebyshev ephemeris file made by the chebyshev tool. The file
+* must have been written on a machine with the same byte order.
+*/
+struct ln_cheb_ephem *ln_cheb_open(const char *file)
+{
+	struct ln_cheb_ephem *ephem;
+	const struct cheb_header *header;
+	const struct cheb_body *body;
+	uint64_t bytes;
+	uint32_t i;
+
+	ephem = calloc(1, sizeof(*ephem));
+	if (ephem == NULL)
+		return NULL;
+
+	if (load_file(ephem, file) < 0)
+		goto err;
+
+	/* check header */
+	header = ephem->data;
+	if (ephem->size < sizeof(*header) ||
+		memcmp(header->magic, CHEB_MAGIC, sizeof(header->magic)) ||
+		header->byte_order != CHEB_BYTE_ORDER ||
+		header->bodies > LN_BODIES ||
+		ephem->size < sizeof(*header) + header->bodies * sizeof(*body))
+		goto err;
+
+	ephem->start_JD = header->start_JD;
+	ephem->end_JD = header->end_JD;
+
+	/* check each body lies within the file */
+	body = (const struct cheb_body *)(header + 1);
+	for (i = 0; i < header->bodies; i++, body++) {
+		if (body->body >= LN_BODIES || body->coeffs == 0 ||
+			body->coeffs > CHEB_MAX_COEFFS || body->granule <= 0.0 ||
+			body->offset % sizeof(double) ||
+			body->granules == 0 || body->granules > ephem->size)
+			goto err;
+
+		bytes = body->granules * 3 * body->coeffs * sizeof(double);
+		if (body->offset > ephem->size || bytes > ephem->size - body->offset ||
+			body->granules * body->granule < ephem->end_JD - ephem->start_JD)
+			goto err;
+
+		ephem->body[body->body] = body;
+		ephem->coeffs[body->body] =
+			(const double *)((const char *)ephem->data + body->offset);
+	}
+
+	return ephem;
+
+err:
+	ln_cheb_close(ephem);
+	return NULL;
+}
+
+/*! \fn void ln_cheb_close(struct ln_cheb_ephem *ephem)
+* \param ephem Ephemeris from ln_cheb_open()
+*
+* Release a Chebyshev ephemeris.
+*/
+void ln_cheb_close(struct ln_cheb_ephem *ephem)
+{
+	if (ephem == NULL)
+		return;
+
+#ifdef USE_MMAP
+	if (ephem->mapped)
+		munmap(ephem->data, ephem->size);
+#else
+	free(ephem->data);
+#endif
+	free(ephem);
+}
+
+/*! \fn void ln_cheb_get_span(const struct ln_cheb_ephem *ephem, double *start_JD, double *end_JD)
+* \param ephem Ephemeris from ln_cheb_open()
+* \param start_JD Pointer to store first Julian Day of the ephemeris
+* \param end_JD Pointer to store last Julian Day of the ephemeris
+*
+* Get the span of time covered by a Chebyshev ephemeris.
+*/
+void ln_cheb_get_span(const struct ln_cheb_ephem *ephem, double *start_JD,
+	double *end_JD)
+{
+	*start_JD = ephem->start_JD;
+	*end_JD = ephem->end_JD;
+}
+
+/* evaluate the 3 coordinates of body at JD, -1 if not in the file */
+static int cheb_eval(const struct ln_cheb_ephem *ephem, int body, double JD,
+	double *value)
+{
+	const struct cheb_body *b;
+	const double *c;
+	double x, x2, b0, b1, b2;
+	uint64_t g;
+	int i, k;
+
+	if (ephem == NULL || body < 0 || body >= LN_BODIES)
+		return -1;
+
+	b = ephem->body[body];
+	if (b == NULL || !(JD >= ephem->start_JD && JD <= ephem->end_JD))
+		return -1;
+
+	/* find granule and scale JD to -1 .. 1 within it */
+	g = (uint64_t)((JD - ephem->start_JD) / b->granule);
+	if (g >= b->granules)
+		g = b->granules - 1;
+	x = 2.0 * (JD - ephem->start_JD - g * b->granule) / b->granule - 1.0;
+	x2 = 2.0 * x;
+
+	c = ephem->coeffs[body] + g * 3 * b->coeffs;
+
+	/* Clenshaw recurrence */
+	for (i = 0; i < 3; i++, c += b->coeffs) {
+		b1 = b2 = 0.0;
+		for (k = b->coeffs - 1; k > 0; k--) {
+			b0 = x2 * b1 - b2 + c[k];
+			b2 = b1;
+			b1 = b0;
+		}
+		value[i] = x * b1 - b2 + c[0];
+	}
+
+	return 0;
+}
+
+/*! \fn int ln_cheb_get_helio_coords(const struct ln_cheb_ephem *ephem, int body, double JD, struct ln_helio_posn *position)
+* \param ephem Ephemeris from ln_cheb_open() or NULL
+* \param body Planet, LN_BODY_MERCURY to LN_BODY_PLUTO
+* \param JD Julian Day
+* \param position Pointer to store heliocentric position
+* \return 0 if the position is from the ephemeris, 1 if it was calculated
+* by ln_get_<planet>_helio_coords() and -1 if body is not a planet.
+*
+* Calculate the heliocentric coordinates of a planet in the FK5 reference
+* frame. If JD is outside the ephemeris, or the planet is not in it,
+* the planet's helio_coords function is used.
+*/
+int ln_cheb_get_helio_coords(const struct ln_cheb_ephem *ephem, int body,
+	double JD, struct ln_helio_posn *position)
+{
+	double value[3];
+
+	if (body < 0 || body >= LN_BODY_MOON)
+		return -1;
+
+	if (cheb_eval(ephem, body, JD, value) < 0) {
+		get_helio_coords[body](JD, position);
+		return 1;
+	}
+
+	position->L = ln_range_degrees(value[0]);
+	position->B = value[1];
+	position->R = value[2];
+	return 0;
+}
+
+/*! \fn int ln_cheb_get_lunar_geo_posn(const struct ln_cheb_ephem *ephem, double JD, struct ln_rect_posn *moon)
+* \param ephem Ephemeris from ln_cheb_open() or NULL
+* \param JD Julian Day
+* \param moon Pointer to store lunar position
+* \return 0 if the position is from the ephemeris, 1 if it was calculated
+* by ln_get_lunar_geo_posn().
+*
+* Calculate the rectangular geocentric lunar coordinates in km, as
+* ln_get_lunar_geo_posn(). If JD is outside the ephemeris, or the Moon is
+* not in it, ln_get_lunar_geo_posn() is used with full precision.
+*/
+int ln_cheb_get_lunar_geo_posn(const struct ln_cheb_ephem *ephem, double JD,
+	struct ln_rect_posn *moon)
+{
+	double value[3];
+
+	if (cheb_eval(ephem, LN_BODY_MOON, JD, value) < 0) {
+		ln_get_lunar_geo_posn(JD, moon, 0.0);
+		return 1;
+	}
+
+	moon->X = value[0];
+	moon->Y = value[1];
+	moon->Z = value[2];
+	return 0;
+}
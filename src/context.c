@@ -0,0 +1,31 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <libnova/context.h>
+
+/*! \fn void ln_ctx_init(struct ln_ctx *ctx, double JD)
+* \param ctx Context to initialise
+* \param JD Julian Day
+*
+* Initialise an epoch context for JD. Nothing is calculated until a _ctx
+* function needs it. To move a context to another Julian Day call
+* ln_ctx_init() again.
+*/
+void ln_ctx_init(struct ln_ctx *ctx, double JD)
+{
+	ctx->JD = JD;
+	ctx->valid = 0;
+}
@@ -0,0 +1,70 @@
+#ifndef	LIBNOVA_DATAPRIV_H
+#define	LIBNOVA_DATAPRIV_H
+
+#include <stdint.h>
+#include <libnova/ln_types.h>
+
+/* Series data file of a library built with --enable-data-file, in the
+ * byte order of the machine that wrote it.
+ *
+ *   struct data_header
+ *   struct data_section [LN_BODIES]
+ *   sections, each starting at a multiple of DATA_ALIGN bytes
+ *
+ * Section LN_BODY_ of a planet holds its VSOP87 series and that of the
+ * Moon the ELP 2000-82B tables, as mkseries wrote them for the
+ * series_tables.c of the same build. Pluto has an empty section. A
+ * section is mapped the first time its body is used, so a program that
+ * only needs the Sun only reads the pages of the Earth.
+ */
+
+#define DATA_MAGIC		"LNDATA1"
+#define DATA_BYTE_ORDER		0x01020304
+#define DATA_VERSION		1
+
+/* section alignment, a multiple of the largest page size in use */
+#define DATA_ALIGN		65536
+
+/* array alignment within a section */
+#define DATA_ARRAY_ALIGN	64
+
+struct data_header
+{
+	char magic[8];
+	uint32_t byte_order;
+	uint32_t version;
+	uint32_t sections;	/* LN_BODIES */
+	uint32_t align;		/* DATA_ALIGN */
+};
+
+struct data_section
+{
+	uint64_t offset;	/* file offset in bytes */
+	uint64_t size;		/* size in bytes */
+};
+
+/* how series_tables.c fills in the array pointers of a section */
+struct data_loader
+{
+	uint64_t size;		/* section size it was made with */
+	void (*load)(const char *base);
+};
+
+#ifdef LN_DATA_FILE
+
+/* loaders of each section, in series_tables.c */
+extern const struct data_loader data_loaders[LN_BODIES];
+
+/* make sure the section of body is loaded */
+void data_load(int body);
+
+#else
+
+/* the series are compiled into the library */
+static inline void data_load(int body)
+{
+}
+
+#endif
+
+#endif	/* LIBNOVA_DATAPRIV_H */
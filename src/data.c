@@ -0,0 +1,143 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Series data file of a library built with --enable-data-file. The file
+ * is LN_DATA_PATH, installed with the library, or LIBNOVA_DATA from the
+ * environment. */
+
+#include "config.h"
+#include "data-priv.h"
+
+#ifdef LN_DATA_FILE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#if defined(HAVE_SYS_MMAN_H) && defined(HAVE_MMAP)
+#include <sys/mman.h>
+#define USE_MMAP
+#endif
+
+static const char *body_names[LN_BODIES] = {
+	"mercury", "venus", "earth", "mars", "jupiter",
+	"saturn", "uranus", "neptune", "pluto", "moon",
+};
+
+/* state of each section */
+#define SECTION_UNLOADED	0
+#define SECTION_LOADING		1
+#define SECTION_LOADED		2
+
+static int state[LN_BODIES];
+
+static const char *data_path(void)
+{
+	const char *path;
+
+	path = getenv("LIBNOVA_DATA");
+	return path ? path : LN_DATA_PATH;
+}
+
+/* map or read the section of body, NULL if the file does not match */
+static const char *map_section(FILE *fp, int body)
+{
+	struct data_header header;
+	struct data_section section[LN_BODIES];
+	char *base;
+
+	if (fread(&header, sizeof(header), 1, fp) != 1 ||
+		memcmp(header.magic, DATA_MAGIC, sizeof(header.magic)) ||
+		header.byte_order != DATA_BYTE_ORDER ||
+		header.version != DATA_VERSION ||
+		header.sections != LN_BODIES ||
+		header.align != DATA_ALIGN ||
+		fread(section, sizeof(section), 1, fp) != 1)
+		return NULL;
+
+	/* made for another build of the library */
+	if (section[body].size != data_loaders[body].size ||
+		section[body].offset % DATA_ALIGN)
+		return NULL;
+
+#ifdef USE_MMAP
+	base = mmap(NULL, section[body].size, PROT_READ, MAP_SHARED,
+		fileno(fp), section[body].offset);
+	if (base == MAP_FAILED)
+		return NULL;
+#else
+	base = malloc(section[body].size);
+	if (base == NULL)
+		return NULL;
+	if (fseek(fp, section[body].offset, SEEK_SET) < 0 ||
+		fread(base, 1, section[body].size, fp) != section[body].size) {
+		free(base);
+		return NULL;
+	}
+#endif
+
+	return base;
+}
+
+/* Map the section and fill in the arrays of its series. Sections stay
+ * loaded until the program exits. There is no way to tell the caller of a
+ * position function that it failed, so a missing or mismatched data file
+ * is fatal, as a missing shared library would be. */
+static void load_section(int body)
+{
+	const char *base;
+	FILE *fp;
+
+	fp = fopen(data_path(), "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "libnova: cannot open data file %s\n",
+			data_path());
+		abort();
+	}
+
+	base = map_section(fp, body);
+	fclose(fp);
+	if (base == NULL) {
+		fprintf(stderr, "libnova: data file %s has no %s series for "
+			"this build\n", data_path(), body_names[body]);
+		abort();
+	}
+
+	data_loaders[body].load(base);
+}
+
+/* The first thread to use a body loads it and any others wait for it.
+ * After that this is one load of the section state. */
+void data_load(int body)
+{
+	int expected = SECTION_UNLOADED;
+
+	if (__atomic_load_n(&state[body], __ATOMIC_ACQUIRE) == SECTION_LOADED)
+		return;
+
+	if (__atomic_compare_exchange_n(&state[body], &expected,
+		SECTION_LOADING, 0, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE)) {
+		load_section(body);
+		__atomic_store_n(&state[body], SECTION_LOADED, __ATOMIC_RELEASE);
+		return;
+	}
+
+	while (__atomic_load_n(&state[body], __ATOMIC_ACQUIRE) != SECTION_LOADED)
+		sched_yield();
+}
+
+#endif /* LN_DATA_FILE */
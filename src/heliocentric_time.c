@@ -22,6 +22,7 @@
 #include <libnova/nutation.h>
 #include <libnova/earth.h>
 #include <libnova/utility.h>
+#include <libnova/context.h>
 
 /*! \fn double ln_get_heliocentric_time_diff(double JD, struct ln_equ_posn *object)
 * \param JD Julian day
@@ -45,13 +46,31 @@
 * See [Wikipedia](https://en.wikipedia.org/wiki/Heliocentric_Julian_Day)
 */
 double ln_get_heliocentric_time_diff(double JD, const struct ln_equ_posn *object)
+{
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	return ln_get_heliocentric_time_diff_ctx(&ctx, object);
+}
+
+/*! \fn double ln_get_heliocentric_time_diff_ctx(struct ln_ctx *ctx, struct ln_equ_posn *object)
+* \param ctx Epoch context
+* \param object Pointer to object (RA, DEC) for which heliocentric correction will be caculated
+*
+* \return Heliocentric correction in fraction of day
+*
+* Calculate heliocentric corection for object at given coordinates for the
+* epoch of ctx, as ln_get_heliocentric_time_diff().
+*/
+double ln_get_heliocentric_time_diff_ctx(struct ln_ctx *ctx,
+	const struct ln_equ_posn *object)
 {
 	double theta, ra, dec, c_dec, obliq;
 	struct ln_nutation nutation;
 	struct ln_helio_posn earth;
 
-	ln_get_nutation(JD, &nutation);
-	ln_get_earth_helio_coords(JD, &earth);
+	ln_get_nutation_ctx(ctx, &nutation);
+	ln_get_earth_helio_coords_ctx(ctx, &earth);
 
 	theta = ln_deg_to_rad(ln_range_degrees(earth.L + 180));
 	ra = ln_deg_to_rad(object->ra);
@@ -0,0 +1,82 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_CHEBYSHEV_H
+#define _LN_CHEBYSHEV_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup chebyshev Chebyshev ephemeris
+*
+* A Chebyshev ephemeris file holds polynomial fits of the VSOP87, Pluto
+* and ELP 2000-82B positions over a fixed span of time, so a position is
+* found with a few multiply adds instead of summing the series. Files are
+* made by the chebyshev tool in the tools directory.
+*
+* The file is memory mapped when the platform supports it. Positions
+* outside the span of the file, or of bodies missing from it, are
+* calculated with the usual libnova functions.
+*/
+
+/*! \struct ln_cheb_ephem
+* \brief Loaded Chebyshev ephemeris file.
+* \ingroup chebyshev
+*/
+struct ln_cheb_ephem;
+
+/*! \fn struct ln_cheb_ephem *ln_cheb_open(const char *file);
+* \brief Load a Chebyshev ephemeris file.
+* \ingroup chebyshev
+*/
+struct ln_cheb_ephem LIBNOVA_EXPORT *ln_cheb_open(const char *file);
+
+/*! \fn void ln_cheb_close(struct ln_cheb_ephem *ephem);
+* \brief Release a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+void LIBNOVA_EXPORT ln_cheb_close(struct ln_cheb_ephem *ephem);
+
+/*! \fn void ln_cheb_get_span(const struct ln_cheb_ephem *ephem, double *start_JD, double *end_JD);
+* \brief Get the span of time covered by a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+void LIBNOVA_EXPORT ln_cheb_get_span(const struct ln_cheb_ephem *ephem,
+	double *start_JD, double *end_JD);
+
+/*! \fn int ln_cheb_get_helio_coords(const struct ln_cheb_ephem *ephem, int body, double JD, struct ln_helio_posn *position);
+* \brief Calculate planet heliocentric coordinates from a Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_cheb_get_helio_coords(const struct ln_cheb_ephem *ephem,
+	int body, double JD, struct ln_helio_posn *position);
+
+/*! \fn int ln_cheb_get_lunar_geo_posn(const struct ln_cheb_ephem *ephem, double JD, struct ln_rect_posn *moon);
+* \brief Calculate the rectangular geocentric lunar coordinates from a
+* Chebyshev ephemeris.
+* \ingroup chebyshev
+*/
+int LIBNOVA_EXPORT ln_cheb_get_lunar_geo_posn(const struct ln_cheb_ephem *ephem,
+	double JD, struct ln_rect_posn *moon);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
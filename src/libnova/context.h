@@ -0,0 +1,52 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_CONTEXT_H
+#define _LN_CONTEXT_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup context Epoch context
+*
+* Positions of many objects at the same instant all need the nutation,
+* the Earth's VSOP87 position and the sidereal time of that instant. A
+* struct ln_ctx remembers them, and the _ctx variants of the position
+* functions take one instead of a Julian Day:
+*
+*	struct ln_ctx ctx;
+*
+*	ln_ctx_init(&ctx, JD);
+*	ln_get_mars_equ_coords_ctx(&ctx, &mars);
+*	ln_get_jupiter_equ_coords_ctx(&ctx, &jupiter);
+*
+* A context is not locked, so each thread should use its own.
+*/
+
+/*! \fn void ln_ctx_init(struct ln_ctx *ctx, double JD);
+* \brief Initialise an epoch context.
+* \ingroup context
+*/
+void LIBNOVA_EXPORT ln_ctx_init(struct ln_ctx *ctx, double JD);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
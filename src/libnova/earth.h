@@ -46,6 +46,41 @@ extern "C" {
 void LIBNOVA_EXPORT ln_get_earth_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_earth_helio_coords_ctx(struct ln_ctx *ctx, struct ln_helio_posn *position);
+* \brief Calculate Earth's heliocentric coordinates for an epoch context
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_ctx(struct ln_ctx *ctx,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_earth_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Earth heliocentric coordinates with specified precision
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_earth_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Earth heliocentric coordinates and their rates of change
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_earth_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Earth heliocentric coordinates for many Julian Days
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_earth_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Earth heliocentric coordinates at equally spaced Julian Days
+* \ingroup earth
+*/
+void LIBNOVA_EXPORT ln_get_earth_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_earth_solar_dist(double JD);
 * \brief Calculate the distance between Earth and the Sun.
 * \ingroup earth
@@ -61,6 +96,13 @@ double LIBNOVA_EXPORT ln_get_earth_solar_dist(double JD);
 void LIBNOVA_EXPORT ln_get_earth_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_earth_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup earth
+* \brief Calculate Earth rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_earth_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 /*! \fn void ln_get_earth_centre_dist(float height, double latitude, double *p_sin_o, double *p_cos_o);
 * \ingroup earth
 * \brief Calculate Earth globe centre distance.
@@ -38,6 +38,13 @@ extern "C" {
 double LIBNOVA_EXPORT ln_get_heliocentric_time_diff(double JD,
 	const struct ln_equ_posn *object);
 
+/*! \fn double ln_get_heliocentric_time_diff_ctx(struct ln_ctx *ctx, struct ln_equ_posn *object)
+* \ingroup heliocentric
+* \brief Calculate approximate heliocentric (barycentric) time correction for an epoch context and object
+*/
+double LIBNOVA_EXPORT ln_get_heliocentric_time_diff_ctx(struct ln_ctx *ctx,
+	const struct ln_equ_posn *object);
+
 #ifdef __cplusplus
 };
 #endif
@@ -59,6 +59,34 @@ int LIBNOVA_EXPORT ln_get_jupiter_rst(double JD,
 void LIBNOVA_EXPORT ln_get_jupiter_helio_coords(double JD,
 		struct ln_helio_posn *position);
 
+/*! \fn void ln_get_jupiter_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Jupiter heliocentric coordinates with specified precision
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_jupiter_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Jupiter heliocentric coordinates and their rates of change
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_jupiter_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Jupiter heliocentric coordinates for many Julian Days
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_jupiter_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Jupiter heliocentric coordinates at equally spaced Julian Days
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_jupiter_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Jupiter's equatorial coordinates.
 * \ingroup jupiter
@@ -67,6 +95,13 @@ void LIBNOVA_EXPORT ln_get_jupiter_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_jupiter_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_jupiter_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Jupiter equatorial coordinates for an epoch context
+* \ingroup jupiter
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_jupiter_earth_dist(double JD);
 * \brief Calculate the distance between Jupiter and the Earth.
 * \ingroup jupiter
@@ -113,6 +148,13 @@ double LIBNOVA_EXPORT ln_get_jupiter_phase(double JD);
 */
 void LIBNOVA_EXPORT ln_get_jupiter_rect_helio(double JD,
 	struct ln_rect_posn *position);
+
+/*! \fn void ln_get_jupiter_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup jupiter
+* \brief Calculate Jupiter rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_jupiter_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
 	
 #ifdef __cplusplus
 };
@@ -137,5 +137,8 @@
 #include <libnova/airmass.h>
 #include <libnova/heliocentric_time.h>
 #include <libnova/constellation.h>
+#include <libnova/chebyshev.h>
+#include <libnova/context.h>
+#include <libnova/planets.h>
 
 #endif
@@ -19,6 +19,8 @@
 #ifndef _LN_TYPES_H
 #define _LN_TYPES_H
 
+#include <stddef.h>
+
 #if !defined(__WIN32__) && (defined(__WIN32) || defined(WIN32))
 #define __WIN32__
 #define ALIGN32
@@ -65,6 +67,23 @@ extern "C" {
 
 #define B1900           2415020.3135
 #define B1950           2433282.4235
+
+/* Solar system bodies */
+#define LN_BODY_MERCURY		0
+#define LN_BODY_VENUS		1
+#define LN_BODY_EARTH		2
+#define LN_BODY_MARS		3
+#define LN_BODY_JUPITER		4
+#define LN_BODY_SATURN		5
+#define LN_BODY_URANUS		6
+#define LN_BODY_NEPTUNE		7
+#define LN_BODY_PLUTO		8
+#define LN_BODY_MOON		9
+#define LN_BODIES		10
+
+/* body masks for ln_get_planets_snapshot() */
+#define LN_BODY_MASK(body)	(1U << (body))
+#define LN_PLANETS_MASK		(LN_BODY_MASK(LN_BODY_MOON) - 1)
 	
 /*!
 ** Date
@@ -335,6 +354,102 @@ struct ln_nutation {
 	double ecliptic;	/*!< Mean obliquity of the ecliptic, in degrees */
 };
 
+/*!
+* \struct ln_planet_snapshot
+* \brief Positions of a planet from ln_get_planets_snapshot().
+*
+* The geocentric position is corrected for light time and is the position
+* whose RA and Dec are in equ. For the Earth only helio is set.
+*/
+struct ln_planet_snapshot {
+	struct ln_helio_posn helio;	/*!< Heliocentric FK5 position */
+	struct ln_rect_posn geo;	/*!< Geocentric equatorial rectangular position, AU */
+	struct ln_equ_posn equ;		/*!< Equatorial position as ln_get_<planet>_equ_coords() */
+};
+
+/*!
+* \struct ln_lunar_state
+* \brief Position and appearance of the Moon from ln_get_lunar_state().
+*
+* Angles are expressed in degrees.
+*/
+struct ln_lunar_state {
+	struct ln_rect_posn rect;	/*!< Geocentric position to the mean ecliptic and equinox of J2000, km */
+	struct ln_lnlat_posn ecl;	/*!< Ecliptical longitude and latitude */
+	struct ln_equ_posn equ;		/*!< Equatorial coordinates */
+	double dist;			/*!< Distance from the centre of the Earth, km */
+	double phase;			/*!< Phase angle Sun - Moon - Earth */
+	double disk;			/*!< Illuminated fraction of the disk, 0 to 1 */
+	double bright_limb;		/*!< Position angle of the bright limb */
+	double sdiam;			/*!< Semidiameter in arc seconds */
+};
+
+/*!
+* \struct ln_observer
+* \brief Geographic position and height of an observer.
+*/
+struct ln_observer {
+	struct ln_lnlat_posn posn;	/*!< Longitude, east positive, and latitude */
+	double height;			/*!< Height above sea level, m */
+};
+
+/*!
+* \struct ln_topo_posn
+* \brief Topocentric position of an object from one observer.
+*/
+struct ln_topo_posn {
+	struct ln_equ_posn equ;		/*!< Topocentric equatorial coordinates */
+	struct ln_hrz_posn hrz;		/*!< Azimuth and altitude */
+	double dist;			/*!< Distance from the observer, km */
+};
+
+/* phases of ln_lunar_phases_in_range() */
+#define LN_LUNAR_NEW_MOON	0x01
+#define LN_LUNAR_FIRST_QUARTER	0x02
+#define LN_LUNAR_FULL_MOON	0x04
+#define LN_LUNAR_LAST_QUARTER	0x08
+#define LN_LUNAR_ALL_PHASES	0x0f
+
+/*!
+* \struct ln_lunar_phase
+* \brief A lunar phase from ln_lunar_phases_in_range().
+*/
+struct ln_lunar_phase {
+	double JD;	/*!< Julian Day of the phase */
+	double phase;	/*!< 0 for new moon, 0.25 for first quarter, 0.5 for full moon, 0.75 for last quarter */
+};
+
+/* members of struct ln_ctx already calculated */
+#define LN_CTX_NUTATION		0x01
+#define LN_CTX_EARTH		0x02
+#define LN_CTX_SUN		0x04
+#define LN_CTX_SUN_EQU		0x08
+#define LN_CTX_MEAN_SIDEREAL	0x10
+#define LN_CTX_APP_SIDEREAL	0x20
+#define LN_CTX_MOON		0x40
+
+/*!
+* \struct ln_ctx
+* \brief Quantities that depend only on the epoch.
+*
+* A context holds the nutation, Earth and Sun positions, sidereal time and
+* lunar position for one Julian Day. Members are calculated the first time
+* a _ctx function needs them and then reused, so positions of many objects
+* at the same instant share the work. Initialise with ln_ctx_init() and
+* treat the members as read only.
+*/
+struct ln_ctx {
+	double JD;			/*!< Julian Day of the context */
+	unsigned int valid;		/*!< LN_CTX_ flags of calculated members */
+	struct ln_nutation nutation;	/*!< Nutation */
+	struct ln_helio_posn earth;	/*!< Earth heliocentric position */
+	struct ln_helio_posn sun;	/*!< Solar geometric position */
+	struct ln_equ_posn sun_equ;	/*!< Solar apparent equatorial position */
+	double mean_sidereal;		/*!< Mean sidereal time, hours */
+	double apparent_sidereal;	/*!< Apparent sidereal time, hours */
+	struct ln_rect_posn moon;	/*!< Lunar geocentric position, km */
+};
+
 #if defined(__WIN32__) && !defined(__MINGW__)
 
 #include <time.h>
@@ -56,6 +56,55 @@ int LIBNOVA_EXPORT ln_get_lunar_rst(double JD, const struct ln_lnlat_posn *obser
 void LIBNOVA_EXPORT ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon,
 	double precision);
 
+/*! \fn void ln_get_lunar_geo_posn_fast(double JD, struct ln_rect_posn *moon);
+* \brief Calculate the rectangular geocentric lunar coordinates by the abridged theory of Meeus.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_geo_posn_fast(double JD,
+	struct ln_rect_posn *moon);
+
+/*! \fn void ln_get_lunar_ecl_coords_fast(double JD, struct ln_lnlat_posn *position);
+* \brief Calculate lunar ecliptical coordinates by the abridged theory of Meeus.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_ecl_coords_fast(double JD,
+	struct ln_lnlat_posn *position);
+
+/*! \fn void ln_get_lunar_equ_coords_fast(double JD, struct ln_equ_posn *position);
+* \brief Calculate lunar equatorial coordinates by the abridged theory of Meeus.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_equ_coords_fast(double JD,
+	struct ln_equ_posn *position);
+
+/*! \fn void ln_get_lunar_geo_posn_batch(const double *JD, size_t n, struct ln_rect_posn *moon, double precision);
+* \brief Calculate the rectangular geocentric lunar coordinates of many days.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_geo_posn_batch(const double *JD, size_t n,
+	struct ln_rect_posn *moon, double precision);
+
+/*! \fn void ln_get_lunar_geo_posvel(double JD, struct ln_rect_posn *moon, struct ln_rect_posn *velocity, double precision);
+* \brief Calculate the rectangular geocentric lunar coordinates and their rates of change.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_geo_posvel(double JD,
+	struct ln_rect_posn *moon, struct ln_rect_posn *velocity,
+	double precision);
+
+/*! \fn int ln_set_lunar_threads(int threads);
+* \brief Share the ELP series of each lunar position among threads.
+* \ingroup lunar
+*/
+int LIBNOVA_EXPORT ln_set_lunar_threads(int threads);
+
+/*! \fn void ln_get_lunar_geo_posn_float(double JD, struct ln_rect_posn *moon);
+* \brief Calculate the rectangular geocentric lunar coordinates in single precision.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_geo_posn_float(double JD,
+	struct ln_rect_posn *moon);
+
 /*! \fn void ln_get_lunar_equ_coords_prec(double JD, struct ln_equ_posn *position, double precision);
 * \brief Calculate lunar equatorial coordinates with specified precision.
 * \ingroup lunar
@@ -70,6 +119,13 @@ void LIBNOVA_EXPORT ln_get_lunar_equ_coords_prec(double JD,
 void LIBNOVA_EXPORT ln_get_lunar_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_lunar_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate lunar equatorial coordinates using an epoch context.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn void ln_get_lunar_ecl_coords(double JD, struct ln_lnlat_posn *position, double precision);
 * \brief Calculate lunar ecliptical coordinates at highest precision.
 * \ingroup lunar
@@ -101,6 +157,21 @@ double LIBNOVA_EXPORT ln_get_lunar_earth_dist(double JD);
 */ 
 double LIBNOVA_EXPORT ln_get_lunar_bright_limb(double JD);
 
+/*! \fn void ln_get_lunar_state(double JD, struct ln_lunar_state *state);
+* \brief Calculate the position, phase and limb of the Moon together.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_state(double JD,
+	struct ln_lunar_state *state);
+
+/*! \fn void ln_get_lunar_topo_coords(double JD, const struct ln_lunar_state *state, const struct ln_observer *observers, size_t n, struct ln_topo_posn *topo);
+* \brief Calculate the topocentric position of the Moon for many observers.
+* \ingroup lunar
+*/
+void LIBNOVA_EXPORT ln_get_lunar_topo_coords(double JD,
+	const struct ln_lunar_state *state, const struct ln_observer *observers,
+	size_t n, struct ln_topo_posn *topo);
+
 /*! \fn double ln_get_lunar_long_asc_node(double JD);
 * \brief Calculate the longitude of the Moon's mean ascending node.
 * \ingroup lunar
@@ -143,6 +214,13 @@ double LIBNOVA_EXPORT ln_lunar_next_phase(double jd, double phase);
 */
 double LIBNOVA_EXPORT ln_lunar_previous_phase(double jd, double phase);
 
+/*! \fn int ln_lunar_phases_in_range(double JD0, double JD1, int mask, struct ln_lunar_phase *phases, int max)
+* \brief Find the lunar phases between two Julian Days.
+* \ingroup lunar
+*/
+int LIBNOVA_EXPORT ln_lunar_phases_in_range(double JD0, double JD1, int mask,
+	struct ln_lunar_phase *phases, int max);
+
 /*! \fn double ln_lunar_next_apsis(double jd, int mode)
 * \brief Find next moon apogee or perigee relative to given time expressed as Julian Day.
 * \ingroup lunar
@@ -53,6 +53,34 @@ int LIBNOVA_EXPORT ln_get_mars_rst(double JD, const struct ln_lnlat_posn *observ
 void LIBNOVA_EXPORT ln_get_mars_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_mars_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Mars heliocentric coordinates with specified precision
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_mars_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Mars heliocentric coordinates and their rates of change
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_mars_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Mars heliocentric coordinates for many Julian Days
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_mars_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Mars heliocentric coordinates at equally spaced Julian Days
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_mars_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Mars equatorial coordinates
 * \ingroup mars
@@ -61,6 +89,13 @@ void LIBNOVA_EXPORT ln_get_mars_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_mars_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_mars_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Mars equatorial coordinates for an epoch context
+* \ingroup mars
+*/
+void LIBNOVA_EXPORT ln_get_mars_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_mars_earth_dist(double JD);
 * \brief Calculate the distance between Mars and the Earth.
 * \ingroup mars
@@ -107,6 +142,13 @@ double LIBNOVA_EXPORT ln_get_mars_phase(double JD);
 */
 void LIBNOVA_EXPORT ln_get_mars_rect_helio(double JD,
 	struct ln_rect_posn *position);
+
+/*! \fn void ln_get_mars_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup mars
+* \brief Calculate Mars rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_mars_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
 	
 #ifdef __cplusplus
 };
@@ -53,6 +53,34 @@ int LIBNOVA_EXPORT ln_get_mercury_rst(double JD,
 void LIBNOVA_EXPORT ln_get_mercury_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_mercury_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Mercury heliocentric coordinates with specified precision
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_mercury_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Mercury heliocentric coordinates and their rates of change
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_mercury_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Mercury heliocentric coordinates for many Julian Days
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_mercury_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Mercury heliocentric coordinates at equally spaced Julian Days
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_mercury_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Mercury's equatorial coordinates
 * \ingroup mercury
@@ -61,6 +89,13 @@ void LIBNOVA_EXPORT ln_get_mercury_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_mercury_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_mercury_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Mercury equatorial coordinates for an epoch context
+* \ingroup mercury
+*/
+void LIBNOVA_EXPORT ln_get_mercury_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_mercury_earth_dist(double JD);
 * \brief Calculate the distance between Mercury and the Earth.
 * \ingroup mercury
@@ -109,6 +144,13 @@ double LIBNOVA_EXPORT ln_get_mercury_phase(double JD);
 void LIBNOVA_EXPORT ln_get_mercury_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_mercury_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup mercury
+* \brief Calculate Mercury rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_mercury_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
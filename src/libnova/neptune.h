@@ -53,6 +53,34 @@ int LIBNOVA_EXPORT ln_get_neptune_rst(double JD,
 void LIBNOVA_EXPORT ln_get_neptune_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_neptune_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Neptune heliocentric coordinates with specified precision
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_neptune_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Neptune heliocentric coordinates and their rates of change
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_neptune_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Neptune heliocentric coordinates for many Julian Days
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_neptune_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Neptune heliocentric coordinates at equally spaced Julian Days
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_neptune_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Neptune's equatorial coordinates.
 * \ingroup neptune
@@ -60,6 +88,13 @@ void LIBNOVA_EXPORT ln_get_neptune_helio_coords(double JD,
 /* Chapter 31 Pg 206-207 Equ 31.1 31.2 , 31.3 using VSOP 87 */
 void LIBNOVA_EXPORT ln_get_neptune_equ_coords(double JD,
 	struct ln_equ_posn *position);
+
+/*! \fn void ln_get_neptune_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Neptune equatorial coordinates for an epoch context
+* \ingroup neptune
+*/
+void LIBNOVA_EXPORT ln_get_neptune_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
 		
 /*! \fn double ln_get_neptune_earth_dist(double JD);
 * \brief Calculate the distance between Neptune and the Earth.
@@ -108,6 +143,13 @@ double LIBNOVA_EXPORT ln_get_neptune_phase(double JD);
 void LIBNOVA_EXPORT ln_get_neptune_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_neptune_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup neptune
+* \brief Calculate Neptune rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_neptune_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
@@ -43,6 +43,13 @@ extern "C" {
 */
 void LIBNOVA_EXPORT ln_get_nutation(double JD, struct ln_nutation *nutation);
 
+/*! \fn void ln_get_nutation_ctx(struct ln_ctx *ctx, struct ln_nutation *nutation);
+* \ingroup nutation
+* \brief Calculate nutation for an epoch context.
+*/
+void LIBNOVA_EXPORT ln_get_nutation_ctx(struct ln_ctx *ctx,
+	struct ln_nutation *nutation);
+
 /*! \fn void ln_get_equ_nut(struct ln_equ_posn *mean_position, double JD, struct ln_equ_posn *position);
 * \brief Calculate equatorial coordinates with the effects of nutation.
 * \ingroup nutation
@@ -0,0 +1,60 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#ifndef _LN_PLANETS_H
+#define _LN_PLANETS_H
+
+#include <libnova/ln_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! \defgroup planets All planets
+*
+* Positions of every planet at one instant, for drawing the sky or looking
+* for conjunctions. The Earth and the Sun are calculated once and each
+* planet is summed once for its position and velocity, which also give its
+* light time. Bodies are chosen by a mask of LN_BODY_MASK() bits:
+*
+*	struct ln_planet_snapshot planet[LN_BODY_MOON];
+*
+*	ln_get_planets_snapshot(JD, LN_BODY_MASK(LN_BODY_MARS) |
+*		LN_BODY_MASK(LN_BODY_JUPITER), planet);
+*
+* When libnova is configured with --enable-threads the planets are shared
+* among OpenMP threads, whose number can be set with OMP_NUM_THREADS.
+*/
+
+/*! \fn int ln_get_planets_snapshot(double JD, unsigned int mask, struct ln_planet_snapshot *out);
+* \brief Calculate the positions of many planets at once.
+* \ingroup planets
+*/
+int LIBNOVA_EXPORT ln_get_planets_snapshot(double JD, unsigned int mask,
+	struct ln_planet_snapshot *out);
+
+/*! \fn int ln_get_planet_helio_coords_float(int body, double JD, struct ln_helio_posn *position);
+* \brief Calculate the heliocentric position of a planet in single precision.
+* \ingroup planets
+*/
+int LIBNOVA_EXPORT ln_get_planet_helio_coords_float(int body, double JD,
+	struct ln_helio_posn *position);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif
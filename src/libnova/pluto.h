@@ -53,6 +53,20 @@ int LIBNOVA_EXPORT ln_get_pluto_rst(double JD, const struct ln_lnlat_posn *obser
 void LIBNOVA_EXPORT ln_get_pluto_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_pluto_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Pluto's heliocentric coordinates for many Julian Days
+* \ingroup pluto
+*/
+void LIBNOVA_EXPORT ln_get_pluto_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_pluto_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Pluto heliocentric coordinates at equally spaced Julian Days
+* \ingroup pluto
+*/
+void LIBNOVA_EXPORT ln_get_pluto_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_pluto_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Pluto's equatorial coordinates.
 * \ingroup pluto
@@ -60,6 +74,13 @@ void LIBNOVA_EXPORT ln_get_pluto_helio_coords(double JD,
 /* Chapter 37 */
 void LIBNOVA_EXPORT ln_get_pluto_equ_coords(double JD,
 	struct ln_equ_posn *position);
+
+/*! \fn void ln_get_pluto_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Pluto equatorial coordinates for an epoch context
+* \ingroup pluto
+*/
+void LIBNOVA_EXPORT ln_get_pluto_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
 		
 /*! \fn double ln_get_pluto_earth_dist(double JD);
 * \brief Calculate the distance between Pluto and the Earth.
@@ -59,6 +59,34 @@ int LIBNOVA_EXPORT ln_get_saturn_rst(double JD, const struct ln_lnlat_posn *obse
 void LIBNOVA_EXPORT ln_get_saturn_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_saturn_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Saturn heliocentric coordinates with specified precision
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_saturn_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Saturn heliocentric coordinates and their rates of change
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_saturn_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Saturn heliocentric coordinates for many Julian Days
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_saturn_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Saturn heliocentric coordinates at equally spaced Julian Days
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_saturn_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Saturn's equatorial coordinates.
 * \ingroup saturn
@@ -67,6 +95,13 @@ void LIBNOVA_EXPORT ln_get_saturn_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_saturn_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_saturn_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Saturn equatorial coordinates for an epoch context
+* \ingroup saturn
+*/
+void LIBNOVA_EXPORT ln_get_saturn_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_saturn_earth_dist(double JD);
 * \brief Calculate the distance between Saturn and the Earth.
 * \ingroup saturn
@@ -114,6 +149,13 @@ double LIBNOVA_EXPORT ln_get_saturn_phase(double JD);
 void LIBNOVA_EXPORT ln_get_saturn_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_saturn_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup saturn
+* \brief Calculate Saturn rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_saturn_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
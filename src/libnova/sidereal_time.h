@@ -48,6 +48,18 @@ double LIBNOVA_EXPORT ln_get_mean_sidereal_time(double JD);
  
 double LIBNOVA_EXPORT ln_get_apparent_sidereal_time(double JD);
 
+/*! \fn double ln_get_mean_sidereal_time_ctx(struct ln_ctx *ctx)
+* \brief Calculate mean sidereal time for an epoch context.
+* \ingroup sidereal
+*/ 
+double LIBNOVA_EXPORT ln_get_mean_sidereal_time_ctx(struct ln_ctx *ctx);
+
+/*! \fn double ln_get_apparent_sidereal_time_ctx(struct ln_ctx *ctx)
+* \brief Calculate apparent sidereal time for an epoch context.
+* \ingroup sidereal
+*/
+double LIBNOVA_EXPORT ln_get_apparent_sidereal_time_ctx(struct ln_ctx *ctx);
+
 #ifdef __cplusplus
 };
 #endif
@@ -67,6 +67,13 @@ int LIBNOVA_EXPORT ln_get_solar_rst(double JD, const struct ln_lnlat_posn *obser
 void LIBNOVA_EXPORT ln_get_solar_geom_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_solar_geom_coords_ctx(struct ln_ctx *ctx, struct ln_helio_posn *position);
+* \brief Calculate solar geometric coordinates for an epoch context.
+* \ingroup solar 
+*/
+void LIBNOVA_EXPORT ln_get_solar_geom_coords_ctx(struct ln_ctx *ctx,
+	struct ln_helio_posn *position);
+
 /*! \fn void ln_get_solar_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate apparent equatorial coordinates.
 * \ingroup solar
@@ -74,6 +81,13 @@ void LIBNOVA_EXPORT ln_get_solar_geom_coords(double JD,
 void LIBNOVA_EXPORT ln_get_solar_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_solar_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate apparent equatorial coordinates for an epoch context.
+* \ingroup solar
+*/ 
+void LIBNOVA_EXPORT ln_get_solar_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn void ln_get_solar_ecl_coords(double JD, struct ln_lnlat_posn *position);
 * \brief Calculate apparent ecliptical coordinates.
 * \ingroup solar
@@ -81,6 +95,13 @@ void LIBNOVA_EXPORT ln_get_solar_equ_coords(double JD,
 void LIBNOVA_EXPORT ln_get_solar_ecl_coords(double JD,
 	struct ln_lnlat_posn *position);
 
+/*! \fn void ln_get_solar_ecl_coords_ctx(struct ln_ctx *ctx, struct ln_lnlat_posn *position);
+* \brief Calculate apparent ecliptical coordinates for an epoch context.
+* \ingroup solar
+*/ 
+void LIBNOVA_EXPORT ln_get_solar_ecl_coords_ctx(struct ln_ctx *ctx,
+	struct ln_lnlat_posn *position);
+
 /*! \fn void ln_get_solar_geo_coords(double JD, struct ln_rect_posn *position)
 * \brief Calculate geocentric coordinates (rectangular)
 * \ingroup solar
@@ -144,6 +144,15 @@ extern "C" {
 void LIBNOVA_EXPORT ln_get_hrz_from_equ(const struct ln_equ_posn *object,
 	const struct ln_lnlat_posn *observer, double JD, struct ln_hrz_posn *position);
 
+/*! \fn void ln_get_hrz_from_equ_ctx(struct ln_ctx *ctx, struct ln_equ_posn *object, struct ln_lnlat_posn *observer, struct ln_hrz_posn *position);
+* \brief Calculate horizontal coordinates from equatorial coordinates for
+* an epoch context
+* \ingroup transform 
+*/
+void LIBNOVA_EXPORT ln_get_hrz_from_equ_ctx(struct ln_ctx *ctx,
+	const struct ln_equ_posn *object, const struct ln_lnlat_posn *observer,
+	struct ln_hrz_posn *position);
+
 /*!
 * \brief Calculate horizontal coordinates from equatorial coordinates,
 * using mean sidereal time.
@@ -167,6 +176,14 @@ void LIBNOVA_EXPORT ln_get_hrz_from_equ_sidereal_time(const struct ln_equ_posn *
 void LIBNOVA_EXPORT ln_get_equ_from_ecl(const struct ln_lnlat_posn *object,
 	double JD, struct ln_equ_posn *position);
 
+/*! \fn void ln_get_equ_from_ecl_ctx(struct ln_ctx *ctx, struct ln_lnlat_posn *object, struct ln_equ_posn *position);
+* \brief Calculate equatorial coordinates from ecliptical coordinates for
+* an epoch context
+* \ingroup transform
+*/
+void LIBNOVA_EXPORT ln_get_equ_from_ecl_ctx(struct ln_ctx *ctx,
+	const struct ln_lnlat_posn *object, struct ln_equ_posn *position);
+
 /*! \fn void ln_get_ecl_from_equ(struct ln_equ_posn *object, double JD, struct ln_lnlat_posn *position);
 * \brief Calculate ecliptical coordinates from equatorial coordinates 
 * \ingroup transform
@@ -54,6 +54,34 @@ int LIBNOVA_EXPORT ln_get_uranus_rst(double JD, const struct ln_lnlat_posn *obse
 void LIBNOVA_EXPORT ln_get_uranus_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_uranus_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Uranus heliocentric coordinates with specified precision
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_uranus_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Uranus heliocentric coordinates and their rates of change
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_uranus_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Uranus heliocentric coordinates for many Julian Days
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_uranus_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Uranus heliocentric coordinates at equally spaced Julian Days
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_uranus_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Uranus equatorial coordinates.
 * \ingroup uranus
@@ -62,6 +90,13 @@ void LIBNOVA_EXPORT ln_get_uranus_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_uranus_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_uranus_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Uranus equatorial coordinates for an epoch context
+* \ingroup uranus
+*/
+void LIBNOVA_EXPORT ln_get_uranus_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_uranus_earth_dist(double JD);
 * \brief Calculate the distance between Uranus and the Earth.
 * \ingroup uranus
@@ -109,6 +144,13 @@ double LIBNOVA_EXPORT ln_get_uranus_phase(double JD);
 void LIBNOVA_EXPORT ln_get_uranus_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_uranus_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup uranus
+* \brief Calculate Uranus rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_uranus_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
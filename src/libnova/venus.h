@@ -53,6 +53,34 @@ int LIBNOVA_EXPORT ln_get_venus_rst(double JD, const struct ln_lnlat_posn *obser
 void LIBNOVA_EXPORT ln_get_venus_helio_coords(double JD,
 	struct ln_helio_posn *position);
 
+/*! \fn void ln_get_venus_helio_coords_prec(double JD, struct ln_helio_posn *position, double precision);
+* \brief Calculate Venus heliocentric coordinates with specified precision
+* \ingroup venus
+*/
+void LIBNOVA_EXPORT ln_get_venus_helio_coords_prec(double JD,
+	struct ln_helio_posn *position, double precision);
+
+/*! \fn void ln_get_venus_helio_posvel(double JD, struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+* \brief Calculate Venus heliocentric coordinates and their rates of change
+* \ingroup venus
+*/
+void LIBNOVA_EXPORT ln_get_venus_helio_posvel(double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/*! \fn void ln_get_venus_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Venus heliocentric coordinates for many Julian Days
+* \ingroup venus
+*/
+void LIBNOVA_EXPORT ln_get_venus_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position);
+
+/*! \fn void ln_get_venus_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position);
+* \brief Calculate Venus heliocentric coordinates at equally spaced Julian Days
+* \ingroup venus
+*/
+void LIBNOVA_EXPORT ln_get_venus_helio_coords_sweep(double JD, double step,
+	size_t n, struct ln_helio_posn *position);
+
 /*! \fn void ln_get_venus_equ_coords(double JD, struct ln_equ_posn *position);
 * \brief Calculate Venus equatorial coordinates
 * \ingroup venus
@@ -61,6 +89,13 @@ void LIBNOVA_EXPORT ln_get_venus_helio_coords(double JD,
 void LIBNOVA_EXPORT ln_get_venus_equ_coords(double JD,
 	struct ln_equ_posn *position);
 
+/*! \fn void ln_get_venus_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \brief Calculate Venus equatorial coordinates for an epoch context
+* \ingroup venus
+*/
+void LIBNOVA_EXPORT ln_get_venus_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position);
+
 /*! \fn double ln_get_venus_earth_dist(double JD);
 * \brief Calculate the distance between Venus and the Earth.
 * \ingroup venus
@@ -108,6 +143,13 @@ double LIBNOVA_EXPORT ln_get_venus_phase(double JD);
 void LIBNOVA_EXPORT ln_get_venus_rect_helio(double JD,
 	struct ln_rect_posn *position);
 
+/*! \fn void ln_get_venus_rect_helio_batch(const double *JD, size_t n, struct ln_rect_posn *position)
+* \ingroup venus
+* \brief Calculate Venus rectangular heliocentric coordinates for many Julian Days.
+*/
+void LIBNOVA_EXPORT ln_get_venus_rect_helio_batch(const double *JD, size_t n,
+	struct ln_rect_posn *position);
+
 #ifdef __cplusplus
 };
 #endif
@@ -29,6 +29,15 @@ extern "C" {
 *
 * Thanks to Messrs. Bretagnon and Francou for publishing planetary 
 * solution VSOP87.
+*
+* The ln_get_<planet>_helio_coords_prec() functions sum only the leading
+* terms of each series. A coordinate is S0 + S1 t + ... + S5 t^5, so the
+* terms dropped from series Sk change it by no more than the sum of their
+* amplitudes times |t|^k. Terms are dropped while the total of these
+* bounds stays within the precision asked for, which limits the difference
+* from the full series to precision radians in longitude and latitude and
+* precision AU in radius vector. The bound holds for any date, though the
+* number of terms needed grows with |t|.
 */
 
 /*! \fn void ln_vsop87_to_fk5(struct ln_helio_posn *position, double JD);
@@ -47,10 +56,20 @@ struct ln_vsop
 	double C;
 };
 
-
+/*! \fn double ln_calc_series(const struct ln_vsop *data, int terms, double t);
+* \ingroup VSOP87
+* \brief Sum a VSOP87 series, using AVX2 or AVX-512 when the CPU has it.
+*/
 double LIBNOVA_EXPORT ln_calc_series(const struct ln_vsop *data, int terms,
 	double t);
 
+/*! \fn void ln_calc_series_sweep(const struct ln_vsop *data, int terms, double t, double dt, size_t n, double *values);
+* \ingroup VSOP87
+* \brief Sum a VSOP87 series at n equally spaced times.
+*/
+void LIBNOVA_EXPORT ln_calc_series_sweep(const struct ln_vsop *data,
+	int terms, double t, double dt, size_t n, double *values);
+
 #ifdef __cplusplus
 };
 #endif
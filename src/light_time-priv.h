@@ -0,0 +1,32 @@
+#ifndef	LIBNOVA_LIGHTTIMEPRIV_H
+#define	LIBNOVA_LIGHTTIMEPRIV_H
+
+#include <libnova/ln_types.h>
+#include <libnova/context.h>
+
+/* FK5 heliocentric equatorial rectangular position of a body in AU and its
+ * velocity in AU per day */
+typedef void (*light_time_posvel)(double JD, struct ln_rect_posn *position,
+	struct ln_rect_posn *velocity);
+
+/* Geocentric equatorial rectangular position of a body at heliocentric r
+ * with velocity v, corrected for light time. g_sol is the geometric solar
+ * position as ln_get_rect_from_helio() of ln_get_solar_geom_coords(). */
+void light_time_geo_rect(const struct ln_rect_posn *g_sol,
+	const struct ln_rect_posn *r, const struct ln_rect_posn *v,
+	struct ln_rect_posn *geo);
+
+/* RA and Dec in degrees of a geocentric rectangular position */
+void light_time_equ_from_geo(const struct ln_rect_posn *geo,
+	struct ln_equ_posn *position);
+
+/* Geocentric equatorial position of a body for the epoch of ctx, corrected
+ * for light time from one call of get_posvel */
+void light_time_equ_coords(struct ln_ctx *ctx, light_time_posvel get_posvel,
+	struct ln_equ_posn *position);
+
+/* Pluto's position and velocity for light_time_equ_coords() */
+void pluto_get_rect_posvel(double JD, struct ln_rect_posn *position,
+	struct ln_rect_posn *velocity);
+
+#endif	/* LIBNOVA_LIGHTTIMEPRIV_H */
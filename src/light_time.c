@@ -0,0 +1,92 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <math.h>
+#include <libnova/solar.h>
+#include <libnova/transform.h>
+#include <libnova/utility.h>
+#include "light_time-priv.h"
+
+/* light time in days per AU, equ 33.3 */
+#define LIGHT_TIME_AU		0.0057755183
+
+/* solar GM in AU^3 / day^2, the square of the Gaussian constant */
+#define GM_SUN			2.959122082855911e-4
+
+/* light time convergence in days, about 1e-4 arcsec for Mercury */
+#define LIGHT_TIME_EPSILON	1e-9
+
+/* Equ 33.10 pg 229. The body is moved back from r by the light time tau
+ * with the Taylor series
+ *
+ *	r(JD - tau) = r - tau * v + tau^2 / 2 * a
+ *
+ * where a = -GM r / |r|^3 is the solar gravity. Even for Mercury the next
+ * term is below 1e-10 AU, so the light time is iterated on the series alone
+ * rather than by evaluating the body again at each new tau. */
+void light_time_geo_rect(const struct ln_rect_posn *g_sol,
+	const struct ln_rect_posn *r, const struct ln_rect_posn *v,
+	struct ln_rect_posn *geo)
+{
+	double a, b, c, delta, diff, last, acc, t = 0;
+
+	delta = sqrt(r->X * r->X + r->Y * r->Y + r->Z * r->Z);
+	acc = -GM_SUN / (delta * delta * delta);
+
+	do {
+		last = t;
+
+		a = g_sol->X + r->X + t * (-v->X + 0.5 * t * acc * r->X);
+		b = g_sol->Y + r->Y + t * (-v->Y + 0.5 * t * acc * r->Y);
+		c = g_sol->Z + r->Z + t * (-v->Z + 0.5 * t * acc * r->Z);
+
+		delta = sqrt(a * a + b * b + c * c);
+		t = delta * LIGHT_TIME_AU;
+		diff = t - last;
+	} while (diff > LIGHT_TIME_EPSILON || diff < -LIGHT_TIME_EPSILON);
+
+	geo->X = a;
+	geo->Y = b;
+	geo->Z = c;
+}
+
+void light_time_equ_from_geo(const struct ln_rect_posn *geo,
+	struct ln_equ_posn *position)
+{
+	double ra, dec, delta;
+
+	delta = sqrt(geo->X * geo->X + geo->Y * geo->Y + geo->Z * geo->Z);
+	ra = atan2(geo->Y, geo->X);
+	dec = asin(geo->Z / delta);
+
+	/* back to hours, degrees */
+	position->ra = ln_range_degrees(ln_rad_to_deg(ra));
+	position->dec = ln_rad_to_deg(dec);
+}
+
+void light_time_equ_coords(struct ln_ctx *ctx, light_time_posvel get_posvel,
+	struct ln_equ_posn *position)
+{
+	struct ln_helio_posn h_sol;
+	struct ln_rect_posn g_sol, r, v, geo;
+
+	ln_get_solar_geom_coords_ctx(ctx, &h_sol);
+	ln_get_rect_from_helio(&h_sol, &g_sol);
+
+	get_posvel(ctx->JD, &r, &v);
+	light_time_geo_rect(&g_sol, &r, &v, &geo);
+	light_time_equ_from_geo(&geo, position);
+}
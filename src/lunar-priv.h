@@ -1,6 +1,31 @@
 #ifndef	LIBNOVA_LUNARPRIV_H
 #define	LIBNOVA_LUNARPRIV_H
 
+#include <math.h>
+#include "vsop87-priv.h"
+
+/* Chapront theory lunar constants */
+#define		RAD		(648000.0 / M_PI)
+#define		DEG		(M_PI / 180.0)
+#define		M_PI2	(2.0 * M_PI)
+#define		PIS2	(M_PI / 2.0)
+#define		ATH		384747.9806743165
+#define		A0		384747.9806448954
+#define		AM		0.074801329518
+#define		ALPHA	0.002571881335
+#define		DTASM	(2.0 * ALPHA / (3.0 * AM))
+#define		W12		(1732559343.73604 / RAD)
+#define		PRECES	(5029.0966 / RAD)
+#define		C1		60.0
+#define		C2		3600.0
+
+/* Corrections of the constants for DE200/LE200 */
+#define		DELNU	((0.55604 / RAD) / W12)
+#define		DELE	(0.01789 / RAD)
+#define		DELG	(-0.08066 / RAD)
+#define		DELNP	((-0.06424 / RAD) / W12)
+#define		DELEP	(-0.12879 / RAD)
+
 /* used for elp1 - 3 */
 struct main_problem
 {
@@ -28,5 +53,127 @@ struct planet_pert
 	double P;
 };
 
+/* Delaunay's arguments.*/
+static const double del[4][5] = {
+	{ 5.198466741027443, 7771.377146811758394, -0.000028449351621, 0.000000031973462, -0.000000000154365 },
+	{ -0.043125180208125, 628.301955168488007, -0.000002680534843, 0.000000000712676, 0.000000000000727 },
+	{ 2.355555898265799, 8328.691426955554562, 0.000157027757616, 0.000000250411114, -0.000000001186339 },
+	{ 1.627905233371468, 8433.466158130539043, -0.000059392100004, -0.000000004949948, 0.000000000020217 }
+};
+
+
+static const double zeta[2] =
+{
+	(218.0 + (18.0 / 60.0) + (59.95571 / 3600.0)) * DEG,
+	((1732559343.73604 / RAD) + PRECES)
+};
+
+
+/* Planetary arguments */
+static const double p[8][2] =
+{
+	{(252.0 + 15.0 / C1 + 3.25986 / C2 ) * DEG, 538101628.68898 / RAD },
+	{(181.0 + 58.0 / C1 + 47.28305 / C2) * DEG, 210664136.43355 / RAD },
+	{(100.0 + (27.0 / 60.0) + (59.22059 / 3600.0)) * DEG, 129597742.2758 / RAD},
+	{(355.0 + 25.0 / C1 + 59.78866 / C2) * DEG, 68905077.59284 / RAD },
+	{(34.0 + 21.0 / C1 + 5.34212 / C2) * DEG, 10925660.42861 / RAD },
+	{(50.0 + 4.0 / C1 + 38.89694 / C2) * DEG, 4399609.65932 / RAD },
+	{(314.0 + 3.0 / C1 + 18.01841 / C2) * DEG, 1542481.19393 / RAD },
+	{(304.0 + 20.0 / C1 + 55.19575 / C2) * DEG, 786550.32074 / RAD }
+};
+
+#define ELP_SERIES	36
+
+/* Fundamental arguments of ELP 4 - 36, linear in t: the planetary
+ * arguments p[] of Mercury to Neptune, the Delaunay arguments del[] D, l',
+ * l and F, and zeta. */
+#define ELP_ARGS	13
+#define ELP_ARG_DEL	8
+#define ELP_ARG_ZETA	12
+
+/* coefficient of t^k, k < 2, of fundamental argument i */
+static inline double elp_arg(int i, int k)
+{
+	if (i < ELP_ARG_DEL)
+		return p[i][k];
+	if (i < ELP_ARG_ZETA)
+		return del[i - ELP_ARG_DEL][k];
+	return zeta[k];
+}
+
+/* ELP 1 - 3 term A * sin(arg[0] + arg[1] * t + ... + arg[4] * t^4) as
+ * written by mkseries from a struct main_problem, the amplitude including
+ * the corrections for DE200 / LE200 and the cosines of ELP 3 turned into
+ * sines. */
+struct elp_main_term
+{
+	double A;
+	double arg[5];
+};
+
+/* largest multiplier of each fundamental argument in ELP 4 - 36 */
+static const int elp_mult_max[ELP_ARGS] = {
+	17, 61, 65, 71, 14, 12, 4, 4, 8, 4, 6, 5, 2,
+};
+
+/* exp(i n arg[k]) for -elp_mult_max[k] <= n <= elp_mult_max[k] of each
+ * argument in turn, the sum of 2 * elp_mult_max[] + 1 */
+#define ELP_POWERS	559
+
+/* largest number of non zero multipliers of an ELP 4 - 36 term */
+#define ELP_FACTORS	7
+
+/* index of exp(i n arg[k]) in the powers */
+static inline int elp_power_index(int k, int n)
+{
+	int i, index = 0;
+
+	for (i = 0; i < k; i++)
+		index += 2 * elp_mult_max[i] + 1;
+	return index + elp_mult_max[k] + n;
+}
+
+/* ELP 4 - 36 term A * sin(phase + n[0] * arg[0] + ... + n[12] * arg[12])
+ * of the fundamental arguments, as written by mkseries from a struct
+ * earth_pert or planet_pert. The multipliers are small integers, so
+ * exp(i (arg - phase)) is the product of the powers power[] of the non
+ * zero ones and the term is S * cos(arg - phase) + C * sin(arg - phase)
+ * with C = A cos(phase) and S = A sin(phase). A term of constant argument
+ * has the single factor exp(0 i arg[0]). */
+struct elp_pert_term
+{
+	double C;
+	double S;
+	unsigned short power[ELP_FACTORS];
+	unsigned char factors;
+};
+
+/* truncation levels, 10^ELP_LEVEL_TOP down to
+ * 10^(ELP_LEVEL_TOP - ELP_LEVELS + 1) arcsecs or km */
+#define ELP_LEVELS	14
+#define ELP_LEVEL_TOP	3
+
+/* One of the 36 ELP series, sorted by decreasing amplitude by mkseries
+ * when the library is built, in series_tables.c. Only the table of its
+ * type is set. cutoff[k] is the number of leading terms needed for the sum
+ * of the amplitudes of the terms after them to be no more than
+ * 10^(ELP_LEVEL_TOP - k) arcsecs or km. */
+struct elp_series
+{
+	const struct elp_main_term *main;	/* ELP 1 - 3 */
+	const struct elp_pert_term *pert;	/* ELP 4 - 36 */
+	int count;
+	int cutoff[ELP_LEVELS];
+};
+
+extern SERIES_CONST struct elp_series elp_series[ELP_SERIES];
+
+/* ELP 4 - 36 as float series of A * cos(B + C * t) for t in Julian
+ * centuries, in series_tables.c. The arguments of ELP 1 - 3 are of fourth
+ * degree in t so they are always summed in double precision. */
+#define ELP_FLOAT_FIRST		4
+#define ELP_FLOAT_SERIES	33
+
+extern SERIES_CONST struct float_series elp_float[ELP_FLOAT_SERIES];
 
 #endif	/* LIBNOVA_LUNARPRIV_H */
@@ -26,10 +26,12 @@
 #include <libnova/solar.h>
 #include <libnova/earth.h>
 #include <libnova/transform.h>
+#include <libnova/sidereal_time.h>
 #include <libnova/rise_set.h>
 #include <libnova/utility.h>
+#include <libnova/context.h>
 #include "lunar-priv.h"
-#include "elp/elp.h"
+#include "data-priv.h"
 
 #ifdef HAVE_LIBsunmath
 #include <sunmath.h>
@@ -38,28 +40,12 @@
 /* AU in KM */
 #define AU			149597870
 
+/* semidiameter of the Moon in arcsecs at 1 km */
+#define LUNAR_SDIAM		358473400
+
+/* equatorial radius of the Earth in km, as ln_get_earth_centre_dist() */
+#define EARTH_RADIUS		6378.14
 
-/* Chapront theory lunar constants */
-#define		RAD		(648000.0 / M_PI)
-#define		DEG		(M_PI / 180.0)
-#define		M_PI2	(2.0 * M_PI)
-#define		PIS2	(M_PI / 2.0)
-#define		ATH		384747.9806743165
-#define		A0		384747.9806448954
-#define		AM		0.074801329518
-#define		ALPHA	0.002571881335
-#define		DTASM	(2.0 * ALPHA / (3.0 * AM))
-#define		W12		(1732559343.73604 / RAD)
-#define		PRECES	(5029.0966 / RAD)
-#define		C1		60.0
-#define		C2		3600.0
-
-/* Corrections of the constants for DE200/LE200 */
-#define		DELNU	((0.55604 / RAD) / W12)
-#define		DELE	(0.01789 / RAD)
-#define		DELG	(-0.08066 / RAD)
-#define		DELNP	((-0.06424 / RAD) / W12)
-#define		DELEP	(-0.12879 / RAD)
 
 /*     Precession matrix */
 #define		P1		0.10180391e-4
@@ -125,990 +111,1017 @@ static const double peri[5] =
 };
 #endif
 
-/* Delaunay's arguments.*/
-static const double del[4][5] = {
-	{ 5.198466741027443, 7771.377146811758394, -0.000028449351621, 0.000000031973462, -0.000000000154365 },
-	{ -0.043125180208125, 628.301955168488007, -0.000002680534843, 0.000000000712676, 0.000000000000727 },
-	{ 2.355555898265799, 8328.691426955554562, 0.000157027757616, 0.000000250411114, -0.000000001186339 },
-	{ 1.627905233371468, 8433.466158130539043, -0.000059392100004, -0.000000004949948, 0.000000000020217 }
-};
+/* terms summed by one thread at a time */
+#define ELP_CHUNK	2048
 
+/* chunks of the 37,800 ELP terms, the 36 series making 49 */
+#define ELP_CHUNKS	64
 
-static const double zeta[2] =
+struct elp_chunk
 {
-	(218.0 + (18.0 / 60.0) + (59.95571 / 3600.0)) * DEG,
-	((1732559343.73604 / RAD) + PRECES)
+	int series;
+	int start;
+	int end;
 };
 
+/* periodic terms of each of the Meeus tables 47.A and 47.B */
+#define MEEUS_TERMS	60
 
-/* Planetary arguments */
-static const double p[8][2] =
-{
-	{(252.0 + 15.0 / C1 + 3.25986 / C2 ) * DEG, 538101628.68898 / RAD },
-	{(181.0 + 58.0 / C1 + 47.28305 / C2) * DEG, 210664136.43355 / RAD },
-	{(100.0 + (27.0 / 60.0) + (59.22059 / 3600.0)) * DEG, 129597742.2758 / RAD},
-	{(355.0 + 25.0 / C1 + 59.78866 / C2) * DEG, 68905077.59284 / RAD },
-	{(34.0 + 21.0 / C1 + 5.34212 / C2) * DEG, 10925660.42861 / RAD },
-	{(50.0 + 4.0 / C1 + 38.89694 / C2) * DEG, 4399609.65932 / RAD },
-	{(314.0 + 3.0 / C1 + 18.01841 / C2) * DEG, 1542481.19393 / RAD },
-	{(304.0 + 20.0 / C1 + 55.19575 / C2) * DEG, 786550.32074 / RAD }
+/* days evaluated together by ln_get_lunar_geo_posn_batch() */
+#define LUNAR_BATCH	8
+
+/* truncation of the VSOP87 series of the Earth in radians when bracketing
+ * a lunar phase, 10 arcsecs */
+#define PHASE_BRACKET_PREC	4.8e-5
+
+/* annual aberration of the Sun in degrees at 1 AU, Meeus equation 25.10 */
+#define PHASE_ABERRATION	(20.4898 / 3600.0)
+
+/* quarter lunations walked by a thread of ln_lunar_phases_in_range(), about
+ * a year, and years at most in one pass */
+#define PHASE_YEAR		48
+#define PHASE_YEARS		16
+
+/* threads the ELP series are shared among */
+static int lunar_threads = 1;
+
+/* power of t multiplying each ELP series */
+static const int elp_power[ELP_SERIES] = {
+	0, 0, 0, 0, 0, 0, 1, 1, 1,
+	0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1,
+	0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2,
 };
 
-/* sum lunar elp1 series */
-static double sum_series_elp1 (double* t)
+/* sum of the first terms of an ELP 1 - 3 main problem series */
+static double sum_main(const struct elp_main_term *elp, int terms,
+	const double *t)
 {
 	double result = 0;
-	double x,y;
-	double tgv;
-	int i,j,k;
-
-	for (j = 0; j < ELP1_SIZE; j++) {
-		/* derivatives of A */
-		tgv = elp1[j].B[0] + DTASM * elp1[j].B[4];
-		x = elp1[j].A + tgv * (DELNP - AM * DELNU) +
-			elp1[j].B[1] * DELG + elp1[j].B[2] *
-			DELE + elp1[j].B[3] * DELEP;
-
-		y = 0;
-		for (k = 0; k < 5; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp1[j].ilu[i] * del[i][k] * t[k];
-		}
+	double y;
+	int j;
 
-		/* y in correct quad */
-		y = ln_range_radians2(y);
-		result += x * sin(y);
+	for (j = 0; j < terms; j++) {
+		y = elp[j].arg[0] + t[1] * (elp[j].arg[1] + t[1] *
+			(elp[j].arg[2] + t[1] * (elp[j].arg[3] +
+			t[1] * elp[j].arg[4])));
+		result += elp[j].A * sin(y);
 	}
 	return result;
 }
 
-/* sum lunar elp2 series */
-static double sum_series_elp2 (double* t)
-{
-	double result = 0;
-	double x,y;
-	double tgv;
-	int i,j,k;
-
-	for (j = 0; j < ELP2_SIZE; j++) {
-		/* derivatives of A */
-		tgv = elp2[j].B[0] + DTASM * elp2[j].B[4];
-		x = elp2[j].A + tgv * (DELNP - AM * DELNU) +
-			elp2[j].B[1] * DELG + elp2[j].B[2] *
-			DELE + elp2[j].B[3] * DELEP;
-
-		y = 0;
-		for (k = 0; k < 5; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp2[j].ilu[i] * del[i][k] * t[k];
+/* cos and sin of the multiples of the fundamental arguments of
+ * ELP 4 - 36 at t[], indexed by elp_power_index(). Only the 13 arguments
+ * themselves need cos() and sin(), their multiples are the powers of
+ * exp(i arg) by complex multiplication. */
+static void elp_powers(const double *t, double *pc, double *ps)
+{
+	double arg, c, s;
+	int i, k, n, zero;
+
+	for (k = 0; k < ELP_ARGS; k++) {
+		arg = elp_arg(k, 0) + elp_arg(k, 1) * t[1];
+		c = cos(arg);
+		s = sin(arg);
+
+		zero = elp_power_index(k, 0);
+		pc[zero] = 1.0;
+		ps[zero] = 0.0;
+		for (n = 1; n <= elp_mult_max[k]; n++) {
+			i = zero + n;
+			pc[i] = pc[i - 1] * c - ps[i - 1] * s;
+			ps[i] = ps[i - 1] * c + pc[i - 1] * s;
+
+			/* exp(-i n arg) is the conjugate */
+			pc[zero - n] = pc[i];
+			ps[zero - n] = -ps[i];
 		}
-		/* y in correct quad */
-		y = ln_range_radians2(y);
-		result += x * sin(y);
 	}
-	return result;
 }
 
-/* sum lunar elp3 series */
-static double sum_series_elp3 (double* t)
+/* sum of the first terms of an ELP 4 - 36 series */
+static double sum_pert(const struct elp_pert_term *elp, int terms,
+	const double *pc, const double *ps)
 {
 	double result = 0;
-	double x,y;
-	double tgv;
-	int i,j,k;
-
-	for (j = 0; j < ELP3_SIZE; j++) {
-		/* derivatives of A */
-		tgv = elp3[j].B[0] + DTASM * elp3[j].B[4];
-		x = elp3[j].A + tgv * (DELNP - AM * DELNU) +
-			elp3[j].B[1] * DELG + elp3[j].B[2] *
-			DELE + elp3[j].B[3] * DELEP;
-
-		y = 0;
-		for (k = 0; k < 5; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp3[j].ilu[i] * del[i][k] * t[k];
+	double c, s, x;
+	int i,j;
+
+	for (j = 0; j < terms; j++) {
+		c = pc[elp[j].power[0]];
+		s = ps[elp[j].power[0]];
+		for (i = 1; i < elp[j].factors; i++) {
+			x = c * pc[elp[j].power[i]] - s * ps[elp[j].power[i]];
+			s = s * pc[elp[j].power[i]] + c * ps[elp[j].power[i]];
+			c = x;
 		}
-		y += (M_PI_2);
-		/* y in correct quad */
-		y = ln_range_radians2(y);
-		result += x * sin(y);
+		result += elp[j].S * c + elp[j].C * s;
 	}
 	return result;
 }
 
-
-/* sum lunar elp4 series */
-static double sum_series_elp4(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
-
-	for (j = 0; j < ELP4_SIZE; j++) {
-		y = elp4[j].O * DEG;
-		for (k = 0; k < 2; k++)  {
-			y += elp4[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp4[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp4[j].A * sin(y);
+/* sum of the first terms of an ELP 1 - 3 series and its rate per Julian
+ * century */
+static double sum_main_posvel(const struct elp_main_term *elp, int terms,
+	const double *t, double *rate)
+{
+	double result = 0, dresult = 0;
+	double y, dy;
+	int j;
+
+	for (j = 0; j < terms; j++) {
+		y = elp[j].arg[0] + t[1] * (elp[j].arg[1] + t[1] *
+			(elp[j].arg[2] + t[1] * (elp[j].arg[3] +
+			t[1] * elp[j].arg[4])));
+		dy = elp[j].arg[1] + t[1] * (2.0 * elp[j].arg[2] + t[1] *
+			(3.0 * elp[j].arg[3] + t[1] * 4.0 * elp[j].arg[4]));
+		result += elp[j].A * sin(y);
+		dresult += elp[j].A * cos(y) * dy;
 	}
+	*rate = dresult;
 	return result;
 }
 
-/* sum lunar elp5 series */
-static double sum_series_elp5(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
-
-	for (j = 0; j < ELP5_SIZE; j++) {
-		y = elp5[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp5[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp5[j].ilu[i] * del[i][k] * t[k];
+/* sum of the first terms of an ELP 4 - 36 series and its rate per Julian
+ * century, pr[] holding the rate of each power */
+static double sum_pert_posvel(const struct elp_pert_term *elp, int terms,
+	const double *pc, const double *ps, const double *pr, double *rate)
+{
+	double result = 0, dresult = 0;
+	double c, s, x, r;
+	int i,j;
+
+	for (j = 0; j < terms; j++) {
+		c = pc[elp[j].power[0]];
+		s = ps[elp[j].power[0]];
+		r = pr[elp[j].power[0]];
+		for (i = 1; i < elp[j].factors; i++) {
+			x = c * pc[elp[j].power[i]] - s * ps[elp[j].power[i]];
+			s = s * pc[elp[j].power[i]] + c * ps[elp[j].power[i]];
+			c = x;
+			r += pr[elp[j].power[i]];
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp5[j].A * sin(y);
+		result += elp[j].S * c + elp[j].C * s;
+		dresult += (elp[j].C * c - elp[j].S * s) * r;
 	}
+	*rate = dresult;
 	return result;
 }
 
-
-/* sum lunar elp6 series */
-static double sum_series_elp6(double *t)
+/* sum of terms start to end - 1 of ELP series i + 1 */
+static double sum_chunk(int i, int start, int end, const double *t,
+	const double *pc, const double *ps)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	const struct elp_series *series = &elp_series[i];
 
-	for (j = 0; j < ELP6_SIZE; j++) {
-		y = elp6[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp6[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp6[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp6[j].A * sin(y);
-	}
-	return result;
+	if (i < 3)
+		return sum_main(series->main + start, end - start, t);
+	else
+		return sum_pert(series->pert + start, end - start, pc, ps);
 }
 
-/* sum lunar elp7 series */
-static double sum_series_elp7(double *t)
+/* Leading terms of a series for a truncation error of no more than max
+ * arcsecs or km, using the first cutoff level at or below max. The bound
+ * of that level is stored in error. */
+static int elp_terms(const struct elp_series *series, double max,
+	double *error)
 {
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP7_SIZE; j++) {
-		A = elp7[j].A * t[1];
-		y = elp7[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp7[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp7[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
+	int level;
+
+	/* at J2000 the series times t or t^2 may drop every term */
+	if (!isfinite(max) || max >= pow(10.0, ELP_LEVEL_TOP)) {
+		*error = pow(10.0, ELP_LEVEL_TOP);
+		return series->cutoff[0];
 	}
-	return result;
+
+	level = (int)ceil(ELP_LEVEL_TOP - log10(max));
+	if (level >= ELP_LEVELS) {
+		*error = 0.0;
+		return series->count;
+	}
+
+	*error = pow(10.0, ELP_LEVEL_TOP - level);
+	return series->cutoff[level];
 }
 
-/* sum lunar elp8 series */
-static double sum_series_elp8(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP8_SIZE; j++) {
-		y = elp8[j].O * DEG;
-		A = elp8[j].A * t[1];
-		for (k = 0; k < 2; k++) {
-			y += elp8[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp8[j].ilu[i] * del[i][k] * t[k];
+/* Terms of the 36 ELP series for |t| no more than t1, truncated for
+ * precision > 0 to within precision radians in longitude and latitude and
+ * km in distance. Series i adds to coordinate i % 3 and its error is no
+ * more than the sum of its dropped amplitudes times |t|^power. As in
+ * vsop87.c the series of a coordinate are truncated from the last down,
+ * each allowed an equal share of the precision not yet used. */
+static void elp_truncate(double t1, double precision, int *terms)
+{
+	const struct elp_series *series;
+	double tn[3], left, error;
+	int i, j;
+
+	tn[0] = 1.0;
+	tn[1] = t1;
+	tn[2] = t1 * t1;
+
+	for (j = 0; j < 3; j++) {
+		/* radians to arcsecs for longitude and latitude */
+		left = j < 2 ? precision * RAD : precision;
+
+		for (i = ELP_SERIES - 3 + j; i >= 0; i -= 3) {
+			series = &elp_series[i];
+			if (precision > 0.0) {
+				terms[i] = elp_terms(series,
+					left / ((i / 3 + 1) * tn[elp_power[i]]),
+					&error);
+				left -= error * tn[elp_power[i]];
+			} else
+				terms[i] = series->count;
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
 	}
-	return result;
 }
 
-/* sum lunar elp9 series */
-static double sum_series_elp9(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP9_SIZE; j++) {
-		A = elp9[j].A * t[1];
-		y = elp9[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp9[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp9[j].ilu[i] * del[i][k] * t[k];
+/* Sum the 36 ELP series at t[] to precision.
+ *
+ * The terms are summed in chunks of no more than ELP_CHUNK, each into its
+ * own partial sum, and the partial sums of a series are added in order.
+ * The result only depends on the chunks, not on how many threads shared
+ * them out. */
+static void sum_elp(const double *t, double precision, double *elp)
+{
+	struct elp_chunk chunk[ELP_CHUNKS];
+	double pc[ELP_POWERS], ps[ELP_POWERS];
+	double partial[ELP_CHUNKS];
+	int i, k, terms[ELP_SERIES], chunks = 0;
+
+	elp_powers(t, pc, ps);
+	elp_truncate(fabs(t[1]), precision, terms);
+
+	for (i = 0; i < ELP_SERIES; i++) {
+		for (k = 0; k < terms[i]; k += ELP_CHUNK) {
+			chunk[chunks].series = i;
+			chunk[chunks].start = k;
+			chunk[chunks].end = k + ELP_CHUNK < terms[i] ?
+				k + ELP_CHUNK : terms[i];
+			chunks++;
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
 	}
-	return result;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(lunar_threads) \
+	if (lunar_threads > 1)
+#endif
+	for (k = 0; k < chunks; k++)
+		partial[k] = sum_chunk(chunk[k].series, chunk[k].start,
+			chunk[k].end, t, pc, ps);
+
+	for (i = 0; i < ELP_SERIES; i++)
+		elp[i] = 0.0;
+	for (k = 0; k < chunks; k++)
+		elp[chunk[k].series] += partial[k];
+	for (i = 0; i < ELP_SERIES; i++)
+		elp[i] *= t[elp_power[i]];
 }
 
-/* sum lunar elp10 series */
-static double sum_series_elp10(double *t)
+/* Sum the 36 ELP series and their rates per Julian century at t[] to
+ * precision, a series at a time. */
+static void sum_elp_posvel(const double *t, double precision, double *elp,
+	double *delp)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	double pc[ELP_POWERS], ps[ELP_POWERS], pr[ELP_POWERS];
+	double rate;
+	int i, k, n, terms[ELP_SERIES];
 
-	for (j = 0; j < ELP10_SIZE; j++) {
-		y = elp10[j].theta * DEG;
+	elp_powers(t, pc, ps);
+	elp_truncate(fabs(t[1]), precision, terms);
 
-		for (k = 0; k < 2; k++) {
-			y += (elp10[j].ipla[8] * del[0][k]
-			+ elp10[j].ipla[9] * del[2][k]
-			+ elp10[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp10[j].ipla[i] * p[i][k] * t[k];
-		}
+	/* rate of the argument of each power */
+	for (k = 0; k < ELP_ARGS; k++) {
+		for (n = -elp_mult_max[k]; n <= elp_mult_max[k]; n++)
+			pr[elp_power_index(k, n)] = n * elp_arg(k, 1);
+	}
 
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp10[j].O * sin(y);
+	for (i = 0; i < ELP_SERIES; i++) {
+		if (i < 3)
+			elp[i] = sum_main_posvel(elp_series[i].main, terms[i], t,
+				&rate);
+		else
+			elp[i] = sum_pert_posvel(elp_series[i].pert, terms[i],
+				pc, ps, pr, &rate);
+
+		/* series times t^power */
+		delp[i] = rate * t[elp_power[i]];
+		if (elp_power[i] > 0)
+			delp[i] += elp_power[i] * elp[i] * t[elp_power[i] - 1];
+		elp[i] *= t[elp_power[i]];
 	}
-	return result;
 }
 
-/* sum lunar elp11 series */
-static double sum_series_elp11(double *t)
+/*! \fn int ln_set_lunar_threads(int threads);
+* \param threads Number of threads, 1 or less to use the calling thread only.
+* \return Number of threads the ELP series will be shared among.
+* \ingroup lunar
+*
+* Share the ELP 2000-82B series of each lunar position among threads, for
+* the lowest latency of a single position. The series are split into fixed
+* chunks and their partial sums added in order, so positions are the same
+* to the bit whatever the number of threads. It needs a library configured
+* with --enable-threads, otherwise the return is always 1. The default is 1.
+*/
+int ln_set_lunar_threads(int threads)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
-
-	for (j = 0; j < ELP11_SIZE; j++) {
-		y = elp11[j].theta * DEG;
-		for (k = 0; k < 2; k++)  {
-			y += (elp11[j].ipla[8] * del[0][k]
-			+ elp11[j].ipla[9] * del[2][k]
-			+ elp11[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp11[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp11[j].O * sin(y);
-	}
-	return result;
+#ifdef _OPENMP
+	lunar_threads = threads > 1 ? threads : 1;
+#endif
+	return lunar_threads;
 }
 
-/* sum lunar elp12 series */
-static double sum_series_elp12(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
+/* Meeus, chapter 47, table 47.A: multipliers of D, M, M' and F and the
+ * coefficients of the sine of longitude in 1e-6 degrees and of the cosine
+ * of distance in 1e-3 km */
+static const struct meeus_lr {
+	signed char D, M, Mp, F;
+	int l, r;
+} meeus_lr[MEEUS_TERMS] = {
+	{0, 0, 1, 0, 6288774, -20905355},
+	{2, 0, -1, 0, 1274027, -3699111},
+	{2, 0, 0, 0, 658314, -2955968},
+	{0, 0, 2, 0, 213618, -569925},
+	{0, 1, 0, 0, -185116, 48888},
+	{0, 0, 0, 2, -114332, -3149},
+	{2, 0, -2, 0, 58793, 246158},
+	{2, -1, -1, 0, 57066, -152138},
+	{2, 0, 1, 0, 53322, -170733},
+	{2, -1, 0, 0, 45758, -204586},
+	{0, 1, -1, 0, -40923, -129620},
+	{1, 0, 0, 0, -34720, 108743},
+	{0, 1, 1, 0, -30383, 104755},
+	{2, 0, 0, -2, 15327, 10321},
+	{0, 0, 1, 2, -12528, 0},
+	{0, 0, 1, -2, 10980, 79661},
+	{4, 0, -1, 0, 10675, -34782},
+	{0, 0, 3, 0, 10034, -23210},
+	{4, 0, -2, 0, 8548, -21636},
+	{2, 1, -1, 0, -7888, 24208},
+	{2, 1, 0, 0, -6766, 30824},
+	{1, 0, -1, 0, -5163, -8379},
+	{1, 1, 0, 0, 4987, -16675},
+	{2, -1, 1, 0, 4036, -12831},
+	{2, 0, 2, 0, 3994, -10445},
+	{4, 0, 0, 0, 3861, -11650},
+	{2, 0, -3, 0, 3665, 14403},
+	{0, 1, -2, 0, -2689, -7003},
+	{2, 0, -1, 2, -2602, 0},
+	{2, -1, -2, 0, 2390, 10056},
+	{1, 0, 1, 0, -2348, 6322},
+	{2, -2, 0, 0, 2236, -9884},
+	{0, 1, 2, 0, -2120, 5751},
+	{0, 2, 0, 0, -2069, 0},
+	{2, -2, -1, 0, 2048, -4950},
+	{2, 0, 1, -2, -1773, 4130},
+	{2, 0, 0, 2, -1595, 0},
+	{4, -1, -1, 0, 1215, -3958},
+	{0, 0, 2, 2, -1110, 0},
+	{3, 0, -1, 0, -892, 3258},
+	{2, 1, 1, 0, -810, 2616},
+	{4, -1, -2, 0, 759, -1897},
+	{0, 2, -1, 0, -713, -2117},
+	{2, 2, -1, 0, -700, 2354},
+	{2, 1, -2, 0, 691, 0},
+	{2, -1, 0, -2, 596, 0},
+	{4, 0, 1, 0, 549, -1423},
+	{0, 0, 4, 0, 537, -1117},
+	{4, -1, 0, 0, 520, -1571},
+	{1, 0, -2, 0, -487, -1739},
+	{2, 1, 0, -2, -399, 0},
+	{0, 0, 2, -2, -381, -4421},
+	{1, 1, 1, 0, 351, 0},
+	{3, 0, -2, 0, -340, 0},
+	{4, 0, -3, 0, 330, 0},
+	{2, -1, 2, 0, 327, 0},
+	{0, 2, 1, 0, -323, 1165},
+	{1, 1, -1, 0, 299, 0},
+	{2, 0, 3, 0, 294, 0},
+	{2, 0, -1, -2, 0, 8752},
+};
 
-	for (j = 0; j < ELP12_SIZE; j++) {
-		y = elp12[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			y += (elp12[j].ipla[8] * del[0][k]
-			+ elp12[j].ipla[9] * del[2][k]
-			+ elp12[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp12[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp12[j].O * sin(y);
-	}
-	return result;
-}
+/* Meeus, chapter 47, table 47.B: multipliers of D, M, M' and F and the
+ * coefficient of the sine of latitude in 1e-6 degrees */
+static const struct meeus_b {
+	signed char D, M, Mp, F;
+	int b;
+} meeus_b[MEEUS_TERMS] = {
+	{0, 0, 0, 1, 5128122},
+	{0, 0, 1, 1, 280602},
+	{0, 0, 1, -1, 277693},
+	{2, 0, 0, -1, 173237},
+	{2, 0, -1, 1, 55413},
+	{2, 0, -1, -1, 46271},
+	{2, 0, 0, 1, 32573},
+	{0, 0, 2, 1, 17198},
+	{2, 0, 1, -1, 9266},
+	{0, 0, 2, -1, 8822},
+	{2, -1, 0, -1, 8216},
+	{2, 0, -2, -1, 4324},
+	{2, 0, 1, 1, 4200},
+	{2, 1, 0, -1, -3359},
+	{2, -1, -1, 1, 2463},
+	{2, -1, 0, 1, 2211},
+	{2, -1, -1, -1, 2065},
+	{0, 1, -1, -1, -1870},
+	{4, 0, -1, -1, 1828},
+	{0, 1, 0, 1, -1794},
+	{0, 0, 0, 3, -1749},
+	{0, 1, -1, 1, -1565},
+	{1, 0, 0, 1, -1491},
+	{0, 1, 1, 1, -1475},
+	{0, 1, 1, -1, -1410},
+	{0, 1, 0, -1, -1344},
+	{1, 0, 0, -1, -1335},
+	{0, 0, 3, 1, 1107},
+	{4, 0, 0, -1, 1021},
+	{4, 0, -1, 1, 833},
+	{0, 0, 1, -3, 777},
+	{4, 0, -2, 1, 671},
+	{2, 0, 0, -3, 607},
+	{2, 0, 2, -1, 596},
+	{2, -1, 1, -1, 491},
+	{2, 0, -2, 1, -451},
+	{0, 0, 3, -1, 439},
+	{2, 0, 2, 1, 422},
+	{2, 0, -3, -1, 421},
+	{2, 1, -1, 1, -366},
+	{2, 1, 0, 1, -351},
+	{4, 0, 0, 1, 331},
+	{2, -1, 1, 1, 315},
+	{2, -2, 0, -1, 302},
+	{0, 0, 1, 3, -283},
+	{2, 1, 1, -1, -229},
+	{1, 1, 0, -1, 223},
+	{1, 1, 0, 1, 223},
+	{0, 1, -2, -1, -220},
+	{2, 1, -1, -1, -220},
+	{1, 0, 1, 1, -185},
+	{2, -1, -2, -1, 181},
+	{0, 1, 2, 1, -177},
+	{4, 0, -2, -1, 176},
+	{4, -1, -1, -1, 166},
+	{1, 0, 1, -1, -164},
+	{4, 0, 1, -1, 132},
+	{1, 0, -1, -1, -119},
+	{4, -1, 0, -1, 115},
+	{2, -2, 0, 1, 107},
+};
 
-/* sum lunar elp13 series */
-static double sum_series_elp13(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP13_SIZE; j++) {
-		y = elp13[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			y += (elp13[j].ipla[8] * del[0][k]
-			+ elp13[j].ipla[9] * del[2][k]
-			+ elp13[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp13[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp13[j].O * t[1];
-		result += x * sin(y);
+/* Geocentric longitude and latitude in degrees to the mean ecliptic and
+ * equinox of date and distance in km of the Moon by the abridged ELP
+ * 2000-82 of Meeus, chapter 47, the 120 largest periodic terms, for t in
+ * Julian centuries. Within about 10 arcsecs of longitude and 4 of latitude
+ * of the full theory. */
+static void meeus_posn(double t, double *lng, double *lat, double *dist)
+{
+	double Lp, D, M, Mp, F, A1, A2, A3, E, e[3];
+	double arg, sl = 0.0, sr = 0.0, sb = 0.0;
+	int i;
+
+	/* Equ 47.1 - 47.5 */
+	Lp = 218.3164477 + t * (481267.88123421 + t * (-0.0015786 +
+		t * (1.0 / 538841.0 - t / 65194000.0)));
+	D = 297.8501921 + t * (445267.1114034 + t * (-0.0018819 +
+		t * (1.0 / 545868.0 - t / 113065000.0)));
+	M = 357.5291092 + t * (35999.0502909 + t * (-0.0001536 +
+		t / 24490000.0));
+	Mp = 134.9633964 + t * (477198.8675055 + t * (0.0087414 +
+		t * (1.0 / 69699.0 - t / 14712000.0)));
+	F = 93.2720950 + t * (483202.0175233 + t * (-0.0036539 +
+		t * (-1.0 / 3526000.0 + t / 863310000.0)));
+	A1 = 119.75 + 131.849 * t;
+	A2 = 53.09 + 479264.290 * t;
+	A3 = 313.45 + 481266.484 * t;
+
+	/* eccentricity of the Earth's orbit for the terms in M, Equ 47.6 */
+	E = 1.0 - t * (0.002516 + 0.0000074 * t);
+	e[0] = 1.0;
+	e[1] = E;
+	e[2] = E * E;
+
+	Lp = ln_deg_to_rad(ln_range_degrees(Lp));
+	D = ln_deg_to_rad(ln_range_degrees(D));
+	M = ln_deg_to_rad(ln_range_degrees(M));
+	Mp = ln_deg_to_rad(ln_range_degrees(Mp));
+	F = ln_deg_to_rad(ln_range_degrees(F));
+	A1 = ln_deg_to_rad(ln_range_degrees(A1));
+	A2 = ln_deg_to_rad(ln_range_degrees(A2));
+	A3 = ln_deg_to_rad(ln_range_degrees(A3));
+
+	for (i = 0; i < MEEUS_TERMS; i++) {
+		arg = meeus_lr[i].D * D + meeus_lr[i].M * M +
+			meeus_lr[i].Mp * Mp + meeus_lr[i].F * F;
+		sl += meeus_lr[i].l * e[abs(meeus_lr[i].M)] * sin(arg);
+		sr += meeus_lr[i].r * e[abs(meeus_lr[i].M)] * cos(arg);
+
+		arg = meeus_b[i].D * D + meeus_b[i].M * M +
+			meeus_b[i].Mp * Mp + meeus_b[i].F * F;
+		sb += meeus_b[i].b * e[abs(meeus_b[i].M)] * sin(arg);
 	}
-	return result;
+
+	/* action of Venus and Jupiter and the flattening of the Earth */
+	sl += 3958.0 * sin(A1) + 1962.0 * sin(Lp - F) + 318.0 * sin(A2);
+	sb += -2235.0 * sin(Lp) + 382.0 * sin(A3) + 175.0 * sin(A1 - F) +
+		175.0 * sin(A1 + F) + 127.0 * sin(Lp - Mp) -
+		115.0 * sin(Lp + Mp);
+
+	*lng = ln_range_degrees(ln_rad_to_deg(Lp) + sl / 1000000.0);
+	*lat = sb / 1000000.0;
+	*dist = 385000.56 + sr / 1000.0;
 }
 
-/* sum lunar elp14 series */
-static double sum_series_elp14(double *t)
+/* difference of the lunar and solar longitudes lng and L in degrees from
+ * angle in radians, between -PI and PI */
+static double phase_offset(double lng, double L, double angle)
 {
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP14_SIZE; j++) {
-		y = elp14[j].theta * DEG;
-		for (k = 0; k < 2; k++)  {
-			y += (elp14[j].ipla[8] * del[0][k]
-			+ elp14[j].ipla[9] * del[2][k]
-			+ elp14[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp14[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp14[j].O * t[1];
-		result += x * sin(y);
-	}
-	return result;
-}
+	double phase;
 
+	phase = ln_deg_to_rad(ln_range_degrees(lng - L)) - angle;
 
-/* sum lunar elp15 series */
-static double sum_series_elp15(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP15_SIZE; j++) {
-		y = elp15[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			y += (elp15[j].ipla[8] * del[0][k]
-			+ elp15[j].ipla[9] * del[2][k]
-			+ elp15[j].ipla[10] * del [3][k]) * t[k];
-			for (i = 0; i < 8; i++)
-				y += elp15[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp15[j].O * t[1];
-		result += x * sin(y);
-	}
-	return result;
+	return fmod(phase + 3.0 * M_PI, 2.0 * M_PI) - M_PI;
 }
 
-/* sum lunar elp16 series */
-static double sum_series_elp16(double *t)
+/* internal function used for find_max/find zero lunar phase calculations,
+ * the difference of the lunar and apparent solar longitudes from arg[0] in
+ * radians, by the abridged theory. The Sun is corrected for aberration. */
+static double lunar_phase(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	struct ln_lnlat_posn moon;
+	struct ln_helio_posn sol;
 
-	for (j = 0; j < ELP16_SIZE; j++) {
-		y = elp16[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp16[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp16[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp16[j].O * sin(y);
-	}
-	return result;
+	ln_get_lunar_ecl_coords_fast(jd, &moon);
+	ln_get_solar_geom_coords(jd, &sol);
+
+	return phase_offset(moon.lng, sol.L - PHASE_ABERRATION / sol.R,
+		arg[0]);
 }
 
-static double sum_series_elp17(double *t)
+/* as lunar_phase() with the VSOP87 series of the Earth truncated to about
+ * the accuracy of the abridged lunar theory, to bracket a phase */
+static double lunar_phase_bracket(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	struct ln_lnlat_posn moon;
+	struct ln_helio_posn earth;
 
-	for (j = 0; j < ELP17_SIZE; j++) {
-		y = elp17[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp17[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp17[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp17[j].O * sin(y);
-	}
-	return result;
+	ln_get_lunar_ecl_coords_fast(jd, &moon);
+	ln_get_earth_helio_coords_prec(jd, &earth, PHASE_BRACKET_PREC);
+
+	return phase_offset(moon.lng, earth.L + 180.0 -
+		PHASE_ABERRATION / earth.R, arg[0]);
 }
 
-static double sum_series_elp18(double *t)
+/* as lunar_phase_bracket() by ELP 2000-82B and the full VSOP87 series */
+static double lunar_phase_elp(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	struct ln_lnlat_posn moon;
+	struct ln_helio_posn sol;
 
-	for (j = 0; j < ELP18_SIZE; j++) {
-		y = elp18[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp18[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp18[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp18[j].O * sin(y);
-	}
-	return result;
-}
+	ln_get_lunar_ecl_coords(jd, &moon, 0.0);
+	ln_get_solar_geom_coords(jd, &sol);
 
-static double sum_series_elp19(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP19_SIZE; j++) {
-		y = elp19[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp19[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp19[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp19[j].O * t[1];
-		result += x * sin(y);
-	}
-	return result;
+	return phase_offset(moon.lng, sol.L - PHASE_ABERRATION / sol.R,
+		arg[0]);
 }
 
-static double sum_series_elp20(double *t)
+/* internal function used for find_max/find zero lunar phase calculations */
+static double lunar_distance(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP20_SIZE; j++) {
-		y = elp20[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp20[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp20[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp20[j].O * t[1];
-		result += x * sin(y);
-	}
-	return result;
+	return ln_get_lunar_earth_dist(jd);
 }
 
-static double sum_series_elp21(double *t)
+/* internal function used for find_max/find zero lunar phase calculations */
+static double lunar_neg_distance(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y,x;
-
-	for (j = 0; j < ELP21_SIZE; j++) {
-		y = elp21[j].theta * DEG;
-		for (k = 0; k < 2; k++) {
-			for (i = 0; i < 4; i++)
-				y += elp21[j].ipla[i + 7] * del[i][k] * t[k];
-			for (i = 0; i < 7; i++)
-				y += elp21[j].ipla[i] * p[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		x = elp21[j].O * t[1];
-		result += x * sin(y);
-	}
-	return result;
+	return -ln_get_lunar_earth_dist(jd);
 }
 
-/* sum lunar elp22 series */
-static double sum_series_elp22(double *t)
+/* internal function used for find_max/find zero lunar phase calculations */
+static double _lunar_ecl_lat(double jd, double *arg)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
-
-	for (j = 0; j < ELP22_SIZE; j++) {
-		y = elp22[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp22[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp22[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp22[j].A * sin(y);
-	}
-	return result;
-}
+	struct ln_lnlat_posn pos;
 
-/* sum lunar elp23 series */
-static double sum_series_elp23(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
+	ln_get_lunar_ecl_coords(jd, &pos, 0);
 
-	for (j = 0; j < ELP23_SIZE; j++) {
-		y = elp23[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp23[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp23[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp23[j].A * sin(y);
-	}
-	return result;
+	return pos.lat;
 }
 
-/* sum lunar elp24 series */
-static double sum_series_elp24(double *t)
+/* Laskar's rotation m from the mean ecliptic of date to the inertial mean
+ * ecliptic and equinox of J2000 at t[], and if dm is not NULL its rate of
+ * change per Julian century */
+static void laskar_matrix(const double *t, double m[3][3], double dm[3][3])
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	double pw,qw, pwqw, pw2, qw2, ra;
+	double dpw, dqw, dpwqw, dpw2, dqw2, dra;
 
-	for (j = 0; j < ELP24_SIZE; j++) {
-		y = elp24[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp24[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp24[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp24[j].A * sin(y);
-	}
-	return result;
-}
+	/* Laskars series */
+	pw = (P1 + P2 * t[1] + P3 * t[2] + P4 * t[3] + P5 * t[4]) * t[1];
+	qw = (Q1 + Q2 * t[1] + Q3 * t[2] + Q4 * t[3] + Q5 * t[4]) * t[1];
+	ra = 2.0 * sqrt(1.0 - pw * pw - qw * qw);
+	pwqw = 2.0 * pw * qw;
+	pw2 = 1.0 - 2.0 * pw * pw;
+	qw2 = 1.0 - 2.0 * qw * qw;
 
-/* sum lunar elp25 series */
-static double sum_series_elp25(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP25_SIZE; j++) {
-		A = elp25[j].A * t[1];
-		y = elp25[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp25[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp25[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
+	if (dm != NULL) {
+		dpw = P1 + 2.0 * P2 * t[1] + 3.0 * P3 * t[2] + 4.0 * P4 * t[3] +
+			5.0 * P5 * t[4];
+		dqw = Q1 + 2.0 * Q2 * t[1] + 3.0 * Q3 * t[2] + 4.0 * Q4 * t[3] +
+			5.0 * Q5 * t[4];
+		dra = -4.0 * (pw * dpw + qw * dqw) / ra;
+		dpwqw = 2.0 * (dpw * qw + pw * dqw);
+		dpw2 = -4.0 * pw * dpw;
+		dqw2 = -4.0 * qw * dqw;
+
+		dm[0][0] = dpw2;
+		dm[0][1] = dpwqw;
+		dm[0][2] = dpw * ra + pw * dra;
+		dm[1][0] = dpwqw;
+		dm[1][1] = dqw2;
+		dm[1][2] = -(dqw * ra + qw * dra);
+		dm[2][0] = -dm[0][2];
+		dm[2][1] = -dm[1][2];
+		dm[2][2] = dpw2 + dqw2;
 	}
-	return result;
-}
 
-/* sum lunar elp26 series */
-static double sum_series_elp26(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP26_SIZE; j++) {
-		A = elp26[j].A * t[1];
-		y = elp26[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp26[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp26[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
-	}
-	return result;
+	pw = pw * ra;
+	qw = qw * ra;
+	m[0][0] = pw2;
+	m[0][1] = pwqw;
+	m[0][2] = pw;
+	m[1][0] = pwqw;
+	m[1][1] = qw2;
+	m[1][2] = -qw;
+	m[2][0] = -pw;
+	m[2][1] = qw;
+	m[2][2] = pw2 + qw2 - 1.0;
 }
 
-/* sum lunar elp27 series */
-static double sum_series_elp27(double *t)
+/* sums of the ELP series of each coordinate, in arcsecs and km */
+static void elp_coords(const double *elp, double *a, double *b, double *c)
 {
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP27_SIZE; j++) {
-		A = elp27[j].A * t[1];
-		y = elp27[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp27[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp27[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
-	}
-	return result;
+	*a = elp[0] + elp[3] + elp[6] + elp[9] + elp[12] +
+		elp[15] + elp[18] + elp[21] + elp[24] +
+		elp[27] + elp[30] + elp[33];
+	*b = elp[1] + elp[4] + elp[7] + elp[10] + elp[13] +
+		elp[16] + elp[19] + elp[22] + elp[25] +
+		elp[28] + elp[31] + elp[34];
+	*c = elp[2] + elp[5] + elp[8] + elp[11] + elp[14] +
+		elp[17] + elp[20] + elp[23] + elp[26] +
+		elp[29] + elp[32] + elp[35];
 }
 
-/* sum lunar elp28 series */
-static double sum_series_elp28(double *t)
+/* sums of the 36 ELP series at t[] to rectangular coordinates to the
+ * inertial mean ecliptic and equinox of J2000 */
+static void elp_to_rect(const double *t, const double *elp,
+	struct ln_rect_posn *moon)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	double a,b,c;
+	double x,y,z;
+	double m[3][3];
 
-	for (j = 0; j < ELP28_SIZE; j++) {
-		y = elp28[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp28[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp28[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp28[j].A * sin(y);
-	}
-	return result;
+	elp_coords(elp, &a, &b, &c);
+
+	/* calculate geocentric coords */
+	a = a / RAD + W1[0] + W1[1] * t[1] + W1[2] * t[2] + W1[3] * t[3]
+	    + W1[4] * t[4];
+	b = b / RAD;
+	c = c * A0 / ATH;
+
+	x = c * cos(b);
+	y = x * sin(a);
+	x = x * cos(a);
+	z = c * sin(b);
+
+	laskar_matrix(t, m, NULL);
+
+	/* save result */
+	moon->X = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+	moon->Y = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+	moon->Z = m[2][0] * x + m[2][1] * y + m[2][2] * z;
 }
 
-/* sum lunar elp29 series */
-static double sum_series_elp29(double *t)
+/* sums of the 36 ELP series and their rates per Julian century at t[] to
+ * the rectangular position and velocity per day of elp_to_rect() */
+static void elp_to_rect_posvel(const double *t, const double *elp,
+	const double *delp, struct ln_rect_posn *moon,
+	struct ln_rect_posn *velocity)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	double a,b,c, da,db,dc;
+	double x,y,z, dx,dy,dz, r,dr;
+	double m[3][3], dm[3][3];
 
-	for (j = 0; j < ELP29_SIZE; j++) {
-		y = elp29[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp29[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp29[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp29[j].A * sin(y);
-	}
-	return result;
-}
+	elp_coords(elp, &a, &b, &c);
+	elp_coords(delp, &da, &db, &dc);
 
+	a = a / RAD + W1[0] + W1[1] * t[1] + W1[2] * t[2] + W1[3] * t[3]
+	    + W1[4] * t[4];
+	da = da / RAD + W1[1] + 2.0 * W1[2] * t[1] + 3.0 * W1[3] * t[2] +
+		4.0 * W1[4] * t[3];
+	b = b / RAD;
+	db = db / RAD;
+	c = c * A0 / ATH;
+	dc = dc * A0 / ATH;
 
-/* sum lunar elp30 series */
-static double sum_series_elp30(double *t)
+	/* spherical to rectangular and the rates */
+	r = c * cos(b);
+	dr = dc * cos(b) - c * sin(b) * db;
+	x = r * cos(a);
+	y = r * sin(a);
+	z = c * sin(b);
+	dx = dr * cos(a) - y * da;
+	dy = dr * sin(a) + x * da;
+	dz = dc * sin(b) + c * cos(b) * db;
+
+	laskar_matrix(t, m, dm);
+
+	moon->X = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+	moon->Y = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+	moon->Z = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+
+	/* per century to per day */
+	velocity->X = (m[0][0] * dx + m[0][1] * dy + m[0][2] * dz +
+		dm[0][0] * x + dm[0][1] * y + dm[0][2] * z) / 36525.0;
+	velocity->Y = (m[1][0] * dx + m[1][1] * dy + m[1][2] * dz +
+		dm[1][0] * x + dm[1][1] * y + dm[1][2] * z) / 36525.0;
+	velocity->Z = (m[2][0] * dx + m[2][1] * dy + m[2][2] * dz +
+		dm[2][0] * x + dm[2][1] * y + dm[2][2] * z) / 36525.0;
+}
+
+/*! \fn void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *pos, double precision);
+* \param JD Julian day.
+* \param pos Pointer to a geocentric position structure to held result.
+* \param precision The truncation level of the series in radians for longitude
+* and latitude and in km for distance. (Valid range 0 - 0.01, 0 being highest accuracy)
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates to the inertial mean
+* ecliptic and equinox of J2000.
+* The geocentric coordinates returned are in units of km.
+*
+* This function is based upon the Lunar Solution ELP2000-82B by
+* Michelle Chapront-Touze and Jean Chapront of the Bureau des Longitudes,
+* Paris.
+*
+* The terms of each series are stored by decreasing amplitude, so a
+* precision > 0 sums only the leading terms whose dropped amplitudes add up
+* to less than it. A precision of 1e-4 takes about a
+* quarter of the time of the full series and 1e-6 about three quarters.
+*/
+/* ELP 2000-82B theory */
+void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precision)
 {
-	double result = 0;
-	int i,j,k;
-	double y;
+	double t[5];
+	double elp[ELP_SERIES];
 
-	for (j = 0; j < ELP30_SIZE; j++) {
-		y = elp30[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp30[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp30[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp30[j].A * sin(y);
-	}
-	return result;
-}
+	data_load(LN_BODY_MOON);
 
+	/* calc julian centuries */
+	t[0] = 1.0;
+	t[1] =(JD - 2451545.0) / 36525.0;
+	t[2] = t[1] * t[1];
+	t[3] = t[2] * t[1];
+	t[4] = t[3] * t[1];
 
-/* sum lunar elp31 series */
-static double sum_series_elp31(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
+	sum_elp(t, precision, elp);
 
-	for (j = 0; j < ELP31_SIZE; j++) {
-		y = elp31[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp31[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp31[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp31[j].A * sin(y);
-	}
-	return result;
+	elp_to_rect(t, elp, moon);
 }
 
-/* sum lunar elp32 series */
-static double sum_series_elp32(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y;
+/* cos and sin of the multiples of the fundamental arguments at the
+ * LUNAR_BATCH times t1[], as elp_powers() */
+static void elp_powers_batch(const double *t1,
+	double pc[][LUNAR_BATCH], double ps[][LUNAR_BATCH])
+{
+	double c[LUNAR_BATCH], s[LUNAR_BATCH], arg;
+	int i, k, n, e, zero;
+
+	for (k = 0; k < ELP_ARGS; k++) {
+		zero = elp_power_index(k, 0);
+		for (e = 0; e < LUNAR_BATCH; e++) {
+			arg = elp_arg(k, 0) + elp_arg(k, 1) * t1[e];
+			c[e] = cos(arg);
+			s[e] = sin(arg);
+			pc[zero][e] = 1.0;
+			ps[zero][e] = 0.0;
+		}
 
-	for (j = 0; j < ELP32_SIZE; j++) {
-		y = elp32[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp32[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp32[j].ilu[i] * del[i][k] * t[k];
+		for (n = 1; n <= elp_mult_max[k]; n++) {
+			i = zero + n;
+			for (e = 0; e < LUNAR_BATCH; e++) {
+				pc[i][e] = pc[i - 1][e] * c[e] - ps[i - 1][e] * s[e];
+				ps[i][e] = ps[i - 1][e] * c[e] + pc[i - 1][e] * s[e];
+				pc[zero - n][e] = pc[i][e];
+				ps[zero - n][e] = -ps[i][e];
+			}
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp32[j].A * sin(y);
 	}
-	return result;
 }
 
-/* sum lunar elp33 series */
-static double sum_series_elp33(double *t)
+/* sum of the first terms of an ELP 1 - 3 series at LUNAR_BATCH times */
+static void sum_main_batch(const struct elp_main_term *elp, int terms,
+	const double *t1, double *sum)
 {
-	double result = 0;
-	int i,j,k;
 	double y;
-
-	for (j = 0; j < ELP33_SIZE; j++) {
-		y = elp33[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp33[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp33[j].ilu[i] * del[i][k] * t[k];
+	int j, e;
+
+	for (j = 0; j < terms; j++) {
+		for (e = 0; e < LUNAR_BATCH; e++) {
+			y = elp[j].arg[0] + t1[e] * (elp[j].arg[1] + t1[e] *
+				(elp[j].arg[2] + t1[e] * (elp[j].arg[3] +
+				t1[e] * elp[j].arg[4])));
+			sum[e] += elp[j].A * sin(y);
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += elp33[j].A * sin(y);
 	}
-	return result;
 }
 
-/* sum lunar elp34 series */
-static double sum_series_elp34(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP34_SIZE; j++) {
-		A = elp34[j].A * t[2];
-		y = elp34[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp34[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp34[j].ilu[i] * del[i][k] * t[k];
+/* sum of the first terms of an ELP 4 - 36 series at LUNAR_BATCH times,
+ * the products of powers running across time */
+static void sum_pert_batch(const struct elp_pert_term *elp, int terms,
+	double pc[][LUNAR_BATCH], double ps[][LUNAR_BATCH], double *sum)
+{
+	double c[LUNAR_BATCH], s[LUNAR_BATCH], x;
+	const double *fc, *fs;
+	int i, j, e;
+
+	for (j = 0; j < terms; j++) {
+		fc = pc[elp[j].power[0]];
+		fs = ps[elp[j].power[0]];
+		for (e = 0; e < LUNAR_BATCH; e++) {
+			c[e] = fc[e];
+			s[e] = fs[e];
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
-	}
-	return result;
-}
-/* sum lunar elp35 series */
-static double sum_series_elp35(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP35_SIZE; j++) {
-		A = elp35[j].A * t[2];
-		y = elp35[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp35[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp35[j].ilu[i] * del[i][k] * t[k];
+		for (i = 1; i < elp[j].factors; i++) {
+			fc = pc[elp[j].power[i]];
+			fs = ps[elp[j].power[i]];
+			for (e = 0; e < LUNAR_BATCH; e++) {
+				x = c[e] * fc[e] - s[e] * fs[e];
+				s[e] = s[e] * fc[e] + c[e] * fs[e];
+				c[e] = x;
+			}
 		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
+		for (e = 0; e < LUNAR_BATCH; e++)
+			sum[e] += elp[j].S * c[e] + elp[j].C * s[e];
 	}
-	return result;
 }
 
-/* sum lunar elp36 series */
-static double sum_series_elp36(double *t)
-{
-	double result = 0;
-	int i,j,k;
-	double y, A;
-
-	for (j = 0; j < ELP36_SIZE; j++) {
-		A = elp36[j].A * t[2];
-		y = elp36[j].O * DEG;
-		for (k = 0; k < 2; k++) {
-			y += elp36[j].iz * zeta[k] * t[k];
-			for (i = 0; i < 4; i++)
-				y += elp36[j].ilu[i] * del[i][k] * t[k];
-		}
-		/* put y in correct quad */
-		y = ln_range_radians2(y);
-		result += A * sin(y);
+/*! \fn void ln_get_lunar_geo_posn_batch(const double *JD, size_t n, struct ln_rect_posn *moon, double precision);
+* \param JD Array of n Julian days.
+* \param n Number of days.
+* \param moon Array of n geocentric positions to hold the results.
+* \param precision The truncation level of the series as for
+* ln_get_lunar_geo_posn().
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates of n days as
+* ln_get_lunar_geo_posn() does. Each term of the ELP series is loaded once
+* per block of 8 days and applied to all of them. The series of
+* a block are truncated for the day furthest from J2000, so the other days
+* may sum more terms than a single call would. The results agree with
+* ln_get_lunar_geo_posn() to rounding.
+*/
+void ln_get_lunar_geo_posn_batch(const double *JD, size_t n,
+	struct ln_rect_posn *moon, double precision)
+{
+	double t1[LUNAR_BATCH], t[5], elp[ELP_SERIES][LUNAR_BATCH], t1max;
+	double (*pc)[LUNAR_BATCH], (*ps)[LUNAR_BATCH];
+	double value[ELP_SERIES];
+	size_t done;
+	int i, e, epochs, terms[ELP_SERIES];
+
+	data_load(LN_BODY_MOON);
+
+	pc = malloc(2 * ELP_POWERS * sizeof(*pc));
+	if (pc == NULL) {
+		/* one day at a time */
+		for (done = 0; done < n; done++)
+			ln_get_lunar_geo_posn(JD[done], &moon[done], precision);
+		return;
 	}
-	return result;
-}
+	ps = pc + ELP_POWERS;
 
-/* internal function used for find_max/find zero lunar phase calculations */
-static double lunar_phase(double jd, double *arg)
-{
-	struct ln_lnlat_posn moon;
-	struct ln_helio_posn sol;
-	double phase;
+	for (done = 0; done < n; done += epochs) {
+		epochs = n - done < LUNAR_BATCH ? n - done : LUNAR_BATCH;
 
-	ln_get_lunar_ecl_coords(jd, &moon, 0);
-	ln_get_solar_geom_coords(jd, &sol);
+		/* a short block repeats its last day */
+		t1max = 0.0;
+		for (e = 0; e < LUNAR_BATCH; e++) {
+			t1[e] = (JD[done + (e < epochs ? e : epochs - 1)] -
+				2451545.0) / 36525.0;
+			t1max = fmax(t1max, fabs(t1[e]));
+		}
 
-	phase = fmod((ln_rad_to_deg(moon.lng - sol.L))
-		+ 3.0 * M_PI - arg[0], 2.0 * M_PI) - M_PI;
+		elp_powers_batch(t1, pc, ps);
+		elp_truncate(t1max, precision, terms);
+
+		for (i = 0; i < ELP_SERIES; i++) {
+			for (e = 0; e < LUNAR_BATCH; e++)
+				elp[i][e] = 0.0;
+			if (i < 3)
+				sum_main_batch(elp_series[i].main, terms[i], t1,
+					elp[i]);
+			else
+				sum_pert_batch(elp_series[i].pert, terms[i], pc, ps,
+					elp[i]);
+		}
 
-	return phase;
-}
+		for (e = 0; e < epochs; e++) {
+			t[0] = 1.0;
+			t[1] = t1[e];
+			t[2] = t[1] * t[1];
+			t[3] = t[2] * t[1];
+			t[4] = t[3] * t[1];
+			for (i = 0; i < ELP_SERIES; i++)
+				value[i] = elp[i][e] * t[elp_power[i]];
+			elp_to_rect(t, value, &moon[done + e]);
+		}
+	}
 
-/* internal function used for find_max/find zero lunar phase calculations */
-static double lunar_distance(double jd, double *arg)
-{
-	return ln_get_lunar_earth_dist(jd);
+	free(pc);
 }
 
-/* internal function used for find_max/find zero lunar phase calculations */
-static double lunar_neg_distance(double jd, double *arg)
+/*! \fn void ln_get_lunar_geo_posvel(double JD, struct ln_rect_posn *moon, struct ln_rect_posn *velocity, double precision);
+* \param JD Julian day.
+* \param moon Pointer to a geocentric position structure to hold the result.
+* \param velocity Pointer to a structure to hold the rate of change of moon.
+* \param precision The truncation level of the series as for
+* ln_get_lunar_geo_posn().
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates as
+* ln_get_lunar_geo_posn() and their rates of change in km per day. Each ELP
+* term is differentiated analytically in the same pass over the series,
+* the rate of its argument following from the rates of the fundamental
+* arguments, so this costs little more than the position alone.
+*/
+void ln_get_lunar_geo_posvel(double JD, struct ln_rect_posn *moon,
+	struct ln_rect_posn *velocity, double precision)
 {
-	return -ln_get_lunar_earth_dist(jd);
-}
+	double t[5];
+	double elp[ELP_SERIES], delp[ELP_SERIES];
 
-/* internal function used for find_max/find zero lunar phase calculations */
-static double _lunar_ecl_lat(double jd, double *arg)
-{
-	struct ln_lnlat_posn pos;
+	data_load(LN_BODY_MOON);
 
-	ln_get_lunar_ecl_coords(jd, &pos, 0);
+	t[0] = 1.0;
+	t[1] = (JD - 2451545.0) / 36525.0;
+	t[2] = t[1] * t[1];
+	t[3] = t[2] * t[1];
+	t[4] = t[3] * t[1];
 
-	return pos.lat;
+	sum_elp_posvel(t, precision, elp, delp);
+
+	elp_to_rect_posvel(t, elp, delp, moon, velocity);
 }
 
-/*! \fn void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *pos, double precision);
+/*! \fn void ln_get_lunar_geo_posn_float(double JD, struct ln_rect_posn *moon);
 * \param JD Julian day.
-* \param pos Pointer to a geocentric position structure to held result.
-* \param precision The truncation level of the series in radians for longitude
-* and latitude and in km for distance. (Valid range 0 - 0.01, 0 being highest accuracy)
+* \param moon Pointer to a geocentric position structure to held result.
 * \ingroup lunar
 *
-* Calculate the rectangular geocentric lunar coordinates to the inertial mean
-* ecliptic and equinox of J2000.
-* The geocentric coordinates returned are in units of km.
+* Calculate the rectangular geocentric lunar coordinates as
+* ln_get_lunar_geo_posn() with full precision, for drawing the sky or
+* screening for events. The main problem series ELP 1 - 3 are summed as
+* there but the other 34,000 terms are summed in single precision, apart
+* from the few whose amplitude needs more.
 *
-* This function is based upon the Lunar Solution ELP2000-82B by
-* Michelle Chapront-Touze and Jean Chapront of the Bureau des Longitudes,
-* Paris.
+* A float holds the argument of a term to about 6e-8 of itself, so the
+* error grows with the time from J2000. The position is within 0.001 km
+* of ln_get_lunar_geo_posn() between 1900 and 2100 and within 0.05 km
+* between 1000 and 3000.
 */
-/* ELP 2000-82B theory */
-void ln_get_lunar_geo_posn(double JD, struct ln_rect_posn *moon, double precision)
+void ln_get_lunar_geo_posn_float(double JD, struct ln_rect_posn *moon)
 {
 	double t[5];
-	double elp[36];
-	double a,b,c;
-	double x,y,z;
-	double pw,qw, pwqw, pw2, qw2, ra;
+	double elp[ELP_SERIES];
+	int i;
+
+	data_load(LN_BODY_MOON);
 
 	/* calc julian centuries */
 	t[0] = 1.0;
-	t[1] =(JD - 2451545.0) / 36525.0;
+	t[1] = (JD - 2451545.0) / 36525.0;
 	t[2] = t[1] * t[1];
 	t[3] = t[2] * t[1];
 	t[4] = t[3] * t[1];
 
-	/* sum elp series */
-	elp[0] = sum_series_elp1(t);
-	elp[1] = sum_series_elp2(t);
-	elp[2] = sum_series_elp3(t);
-	elp[3] = sum_series_elp4(t);
-	elp[4] = sum_series_elp5(t);
-	elp[5] = sum_series_elp6(t);
-	elp[6] = sum_series_elp7(t);
-	elp[7] = sum_series_elp8(t);
-	elp[8] = sum_series_elp9(t);
-	elp[9] = sum_series_elp10(t);
-	elp[10] = sum_series_elp11(t);
-	elp[11] = sum_series_elp12(t);
-	elp[12] = sum_series_elp13(t);
-	elp[13] = sum_series_elp14(t);
-	elp[14] = sum_series_elp15(t);
-	elp[15] = sum_series_elp16(t);
-	elp[16] = sum_series_elp17(t);
-	elp[17] = sum_series_elp18(t);
-	elp[18] = sum_series_elp19(t);
-	elp[19] = sum_series_elp20(t);
-	elp[20] = sum_series_elp21(t);
-	elp[21] = sum_series_elp22(t);
-	elp[22] = sum_series_elp23(t);
-	elp[23] = sum_series_elp24(t);
-	elp[24] = sum_series_elp25(t);
-	elp[25] = sum_series_elp26(t);
-	elp[26] = sum_series_elp27(t);
-	elp[27] = sum_series_elp28(t);
-	elp[28] = sum_series_elp29(t);
-	elp[29] = sum_series_elp30(t);
-	elp[30] = sum_series_elp31(t);
-	elp[31] = sum_series_elp32(t);
-	elp[32] = sum_series_elp33(t);
-	elp[33] = sum_series_elp34(t);
-	elp[34] = sum_series_elp35(t);
-	elp[35] = sum_series_elp36(t);
-
-	a = elp[0] + elp[3] + elp[6] + elp[9] + elp[12] +
-		elp[15] + elp[18] + elp[21] + elp[24] +
-		elp[27] + elp[30] + elp[33];
-	b = elp[1] + elp[4] + elp[7] + elp[10] + elp[13] +
-		elp[16] + elp[19] + elp[22] + elp[25] +
-		elp[28] + elp[31] + elp[34];
-	c = elp[2] + elp[5] + elp[8] + elp[11] + elp[14] +
-		elp[17] + elp[20] + elp[23] + elp[26] +
-		elp[29] + elp[32] + elp[35];
-
-	/* calculate geocentric coords */
-	a = a / RAD + W1[0] + W1[1] * t[1] + W1[2] * t[2] + W1[3] * t[3]
-	    + W1[4] * t[4];
-	b = b / RAD;
-	c = c * A0 / ATH;
+	for (i = 0; i < ELP_FLOAT_FIRST - 1; i++)
+		elp[i] = sum_main(elp_series[i].main, elp_series[i].count, t);
 
-	x = c * cos(b);
-	y = x * sin(a);
-	x = x * cos(a);
-	z = c * sin(b);
+	for (i = ELP_FLOAT_FIRST - 1; i < ELP_SERIES; i++)
+		elp[i] = float_calc_series(&elp_float[i - ELP_FLOAT_FIRST + 1],
+			t[1]) * t[elp_power[i]];
 
-	/* Laskars series */
-	pw = (P1 + P2 * t[1] + P3 * t[2] + P4 * t[3] + P5 * t[4]) * t[1];
-	qw = (Q1 + Q2 * t[1] + Q3 * t[2] + Q4 * t[3] + Q5 * t[4]) * t[1];
-	ra = 2.0 * sqrt(1.0 - pw * pw - qw * qw);
-	pwqw = 2.0 * pw * qw;
-	pw2 = 1.0 - 2.0 * pw * pw;
-	qw2 = 1.0 - 2.0 * qw * qw;
-	pw = pw * ra;
-	qw = qw * ra;
-	a = pw2 * x + pwqw * y + pw * z;
-	b = pwqw * x + qw2 * y - qw * z;
-	c = -pw * x + qw * y + (pw2 + qw2 - 1.0) * z;
+	elp_to_rect(t, elp, moon);
+}
 
-	/* save result */
-	moon->X = a;
-	moon->Y = b;
-	moon->Z = c;
+/* geocentric rectangular to ecliptical long and lat */
+static void get_ecl_from_rect(const struct ln_rect_posn *moon,
+	struct ln_lnlat_posn *position)
+{
+	position->lng = atan2(moon->Y, moon->X);
+	position->lat = atan2(moon->Z,
+		(sqrt((moon->X * moon->X) + (moon->Y * moon->Y))));
+	position->lng = ln_range_degrees(ln_rad_to_deg(position->lng));
+	position->lat = ln_rad_to_deg(position->lat);
 }
 
 /*! \fn void ln_get_lunar_equ_coords_prec(double JD, struct ln_equ_posn *position, double precision);
@@ -1143,6 +1156,29 @@ void ln_get_lunar_equ_coords(double JD, struct ln_equ_posn *position)
 	ln_get_lunar_equ_coords_prec(JD, position, 0);
 }
 
+/*! \fn void ln_get_lunar_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \param ctx Epoch context
+* \param position Pointer to a struct ln_lnlat_posn to store result.
+* \ingroup lunar
+*
+* Calculate the lunar RA and DEC for the epoch of ctx at the highest
+* precision, as ln_get_lunar_equ_coords(). The lunar geocentric position is
+* kept in ctx for later calls.
+*/
+void ln_get_lunar_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position)
+{
+	struct ln_lnlat_posn ecl;
+
+	if (!(ctx->valid & LN_CTX_MOON)) {
+		ln_get_lunar_geo_posn(ctx->JD, &ctx->moon, 0);
+		ctx->valid |= LN_CTX_MOON;
+	}
+
+	get_ecl_from_rect(&ctx->moon, &ecl);
+	ln_get_equ_from_ecl_ctx(ctx, &ecl, position);
+}
+
 /*! \fn void ln_get_lunar_ecl_coords(double JD, struct ln_lnlat_posn *position, double precision);
 * \param JD Julian Day
 * \param position Pointer to a struct ln_lnlat_posn to store result.
@@ -1163,13 +1199,85 @@ void ln_get_lunar_ecl_coords(double JD, struct ln_lnlat_posn *position,
 
 	/* get lunar geocentric position */
 	ln_get_lunar_geo_posn(JD, &moon, precision);
+	get_ecl_from_rect(&moon, position);
+}
 
-	/* convert to long and lat */
-	position->lng = atan2(moon.Y, moon.X);
-	position->lat = atan2(moon.Z,
-		(sqrt((moon.X * moon.X) + (moon.Y * moon.Y))));
-	position->lng = ln_range_degrees(ln_rad_to_deg(position->lng));
-	position->lat = ln_rad_to_deg(position->lat);
+/*! \fn void ln_get_lunar_geo_posn_fast(double JD, struct ln_rect_posn *moon);
+* \param JD Julian day.
+* \param moon Pointer to a geocentric position structure to hold the result.
+* \ingroup lunar
+*
+* Calculate the rectangular geocentric lunar coordinates to the inertial
+* mean ecliptic and equinox of J2000 as ln_get_lunar_geo_posn() by the
+* abridged ELP 2000-82 of Meeus, chapter 47. Its 120 periodic terms put the
+* Moon within about 10 arcsecs in longitude, 4 arcsecs in latitude and
+* 20 km in distance of the full theory between 1900 and 2100, for a few
+* hundredths of the time.
+*/
+void ln_get_lunar_geo_posn_fast(double JD, struct ln_rect_posn *moon)
+{
+	double t[5], m[3][3];
+	double lng, lat, dist, x, y, z;
+
+	t[0] = 1.0;
+	t[1] = (JD - 2451545.0) / 36525.0;
+	t[2] = t[1] * t[1];
+	t[3] = t[2] * t[1];
+	t[4] = t[3] * t[1];
+
+	meeus_posn(t[1], &lng, &lat, &dist);
+
+	/* the mean longitude of ELP, which leaves out the precession of the
+	 * equinox, in place of that of Meeus */
+	lng = ln_deg_to_rad(lng) - ln_deg_to_rad(218.3164477 + t[1] *
+		(481267.88123421 + t[1] * (-0.0015786 + t[1] *
+		(1.0 / 538841.0 - t[1] / 65194000.0)))) +
+		W1[0] + W1[1] * t[1] + W1[2] * t[2] + W1[3] * t[3] +
+		W1[4] * t[4];
+	lat = ln_deg_to_rad(lat);
+
+	x = dist * cos(lat) * cos(lng);
+	y = dist * cos(lat) * sin(lng);
+	z = dist * sin(lat);
+
+	/* mean ecliptic of date to J2000, as ELP */
+	laskar_matrix(t, m, NULL);
+	moon->X = m[0][0] * x + m[0][1] * y + m[0][2] * z;
+	moon->Y = m[1][0] * x + m[1][1] * y + m[1][2] * z;
+	moon->Z = m[2][0] * x + m[2][1] * y + m[2][2] * z;
+}
+
+/*! \fn void ln_get_lunar_ecl_coords_fast(double JD, struct ln_lnlat_posn *position);
+* \param JD Julian Day
+* \param position Pointer to a struct ln_lnlat_posn to store result.
+* \ingroup lunar
+*
+* Calculate the lunar longitude and latitude as ln_get_lunar_ecl_coords()
+* by the abridged theory of ln_get_lunar_geo_posn_fast().
+*/
+void ln_get_lunar_ecl_coords_fast(double JD, struct ln_lnlat_posn *position)
+{
+	struct ln_rect_posn moon;
+
+	ln_get_lunar_geo_posn_fast(JD, &moon);
+	get_ecl_from_rect(&moon, position);
+}
+
+/*! \fn void ln_get_lunar_equ_coords_fast(double JD, struct ln_equ_posn *position);
+* \param JD Julian Day
+* \param position Pointer to a struct ln_equ_posn to store result.
+* \ingroup lunar
+*
+* Calculate the lunar RA and DEC as ln_get_lunar_equ_coords() by the
+* abridged theory of ln_get_lunar_geo_posn_fast(), for rise and set times
+* and drawing the sky.
+*/
+void ln_get_lunar_equ_coords_fast(double JD, struct ln_equ_posn *position)
+{
+	struct ln_lnlat_posn ecl;
+
+	ln_get_lunar_ecl_coords_fast(JD, &ecl);
+	ln_get_equ_from_ecl(&ecl, JD, position);
 }
 
 /*! \fn double ln_get_lunar_earth_dist(double JD);
@@ -1189,6 +1297,38 @@ double ln_get_lunar_earth_dist(double JD)
 }
 
 
+/* phase angle Sun - Moon - Earth from their ecliptical coordinates, the
+ * Earth - Sun distance R in AU and the Earth - Moon distance in km */
+static double phase_angle(const struct ln_lnlat_posn *moon,
+	const struct ln_lnlat_posn *sun, double R, double delta)
+{
+	double lunar_elong;
+
+	/* calc lunar geocentric elongation equ 48.2 */
+	lunar_elong = acos(cos(ln_deg_to_rad(moon->lat)) *
+		cos(ln_deg_to_rad(sun->lng - moon->lng)));
+
+	/* now calc phase Equ 48.2 */
+	R = R * AU; /* convert R to km */
+	return ln_rad_to_deg(atan2((R * sin(lunar_elong)),
+		(delta - R * cos(lunar_elong))));
+}
+
+/* position angle of the bright limb from the equatorial coordinates of
+ * the Moon and Sun, Equ 48.5 */
+static double bright_limb(const struct ln_equ_posn *moon,
+	const struct ln_equ_posn *sun)
+{
+	double x, y;
+
+	x = cos(ln_deg_to_rad(sun->dec)) * sin(ln_deg_to_rad(sun->ra - moon->ra));
+	y = sin(ln_deg_to_rad(sun->dec)) * cos(ln_deg_to_rad(moon->dec))
+		- (cos(ln_deg_to_rad(sun->dec)) * sin(ln_deg_to_rad(moon->dec))
+		* cos(ln_deg_to_rad(sun->ra - moon->ra)));
+
+	return ln_rad_to_deg(ln_range_radians(atan2(x, y)));
+}
+
 /*! \fn double ln_get_lunar_phase(double JD);
 * \param JD Julian Day
 * \return Phase angle. (Value between 0 and 180)
@@ -1198,25 +1338,14 @@ double ln_get_lunar_earth_dist(double JD)
 */
 double ln_get_lunar_phase(double JD)
 {
-	double phase = 0;
 	struct ln_lnlat_posn moon, sunlp;
-	double lunar_elong;
-	double R, delta;
 
 	/* get lunar and solar long + lat */
 	ln_get_lunar_ecl_coords(JD, &moon, 0.0001);
 	ln_get_solar_ecl_coords(JD, &sunlp);
 
-	/* calc lunar geocentric elongation equ 48.2 */
-	lunar_elong = acos(cos(ln_deg_to_rad(moon.lat)) *
-		cos(ln_deg_to_rad(sunlp.lng - moon.lng)));
-
-	/* now calc phase Equ 48.2 */
-	R = ln_get_earth_solar_dist(JD);
-	delta = ln_get_lunar_earth_dist(JD);
-	R = R * AU; /* convert R to km */
-	phase = atan2((R * sin(lunar_elong)), (delta - R * cos(lunar_elong)));
-	return ln_rad_to_deg(phase);
+	return phase_angle(&moon, &sunlp, ln_get_earth_solar_dist(JD),
+		ln_get_lunar_earth_dist(JD));
 }
 
 /*! \fn double ln_get_lunar_disk(double JD);
@@ -1250,27 +1379,112 @@ double ln_get_lunar_disk(double JD)
 */
 double ln_get_lunar_bright_limb(double JD)
 {
-	double angle;
-	double x,y;
-
 	struct ln_equ_posn moon, sunlp;
 
 	/* get lunar and solar long + lat */
 	ln_get_lunar_equ_coords(JD, &moon);
 	ln_get_solar_equ_coords(JD, &sunlp);
 
-	/* Equ 48.5 */
-	x = cos(ln_deg_to_rad(sunlp.dec)) * sin(ln_deg_to_rad(sunlp.ra - moon.ra));
-	y = sin((ln_deg_to_rad(sunlp.dec)) * cos(ln_deg_to_rad(moon.dec)))
-		- (cos(ln_deg_to_rad(sunlp.dec)) * sin(ln_deg_to_rad(moon.dec))
-		* cos(ln_deg_to_rad(sunlp.ra - moon.ra)));
-	angle = atan2(x,y);
+	return bright_limb(&moon, &sunlp);
+}
 
-	angle = ln_range_radians(angle);
-	return ln_rad_to_deg(angle);
+/*! \fn void ln_get_lunar_state(double JD, struct ln_lunar_state *state);
+* \param JD Julian Day
+* \param state Pointer to store the position and appearance of the Moon.
+* \ingroup lunar
+*
+* Calculate the geocentric position, distance, phase angle, illuminated
+* fraction, bright limb and semidiameter of the Moon together. The ELP
+* 2000-82B series are summed once at the highest precision and the Sun
+* once, where calling ln_get_lunar_phase(), ln_get_lunar_disk(),
+* ln_get_lunar_bright_limb() and ln_get_lunar_sdiam() in turn sums the
+* lunar series six times.
+*/
+void ln_get_lunar_state(double JD, struct ln_lunar_state *state)
+{
+	struct ln_ctx ctx;
+	struct ln_lnlat_posn sun_ecl;
+	struct ln_equ_posn sun_equ;
+	struct ln_helio_posn earth;
+
+	ln_ctx_init(&ctx, JD);
+	ln_get_lunar_equ_coords_ctx(&ctx, &state->equ);
+	state->rect = ctx.moon;
+	get_ecl_from_rect(&ctx.moon, &state->ecl);
+	state->dist = sqrt(ctx.moon.X * ctx.moon.X + ctx.moon.Y * ctx.moon.Y +
+		ctx.moon.Z * ctx.moon.Z);
+
+	ln_get_solar_ecl_coords_ctx(&ctx, &sun_ecl);
+	ln_get_solar_equ_coords_ctx(&ctx, &sun_equ);
+	ln_get_earth_helio_coords_ctx(&ctx, &earth);
+
+	state->phase = phase_angle(&state->ecl, &sun_ecl, earth.R, state->dist);
+	state->disk = (1.0 + cos(ln_deg_to_rad(state->phase))) / 2.0;
+	state->bright_limb = bright_limb(&state->equ, &sun_equ);
+	state->sdiam = LUNAR_SDIAM / state->dist;
 }
 
 
+/*! \fn void ln_get_lunar_topo_coords(double JD, const struct ln_lunar_state *state, const struct ln_observer *observers, size_t n, struct ln_topo_posn *topo);
+* \param JD Julian Day
+* \param state Geocentric state of the Moon at JD from ln_get_lunar_state()
+* \param observers Array of n observers
+* \param n Number of observers
+* \param topo Array to store the n topocentric positions
+* \ingroup lunar
+*
+* Calculate the topocentric RA, Dec, azimuth, altitude and distance of the
+* Moon for each observer from one geocentric state, for occultation and
+* eclipse maps. The apparent sidereal time is calculated once and the
+* Moon's position is moved to each observer with the geocentric
+* coordinates of ln_get_earth_centre_dist(). The positions are those of
+* ln_get_parallax() applied to state->equ, and azimuth and altitude are
+* as ln_get_hrz_from_equ_sidereal_time() gives for them at the apparent
+* sidereal time. Refraction is not applied.
+*/
+void ln_get_lunar_topo_coords(double JD, const struct ln_lunar_state *state,
+	const struct ln_observer *observers, size_t n, struct ln_topo_posn *topo)
+{
+	double sidereal, ra, dec, r, z, H, x, y, zt;
+	double p_sin_o, p_cos_o, lat, s, u;
+	size_t i;
+
+	/* apparent sidereal time at Greenwich in radians */
+	sidereal = ln_get_apparent_sidereal_time(JD) * M_PI / 12.0;
+
+	/* the Moon in equatorial radii of the Earth, the unit of
+	 * ln_get_earth_centre_dist() */
+	ra = ln_deg_to_rad(state->equ.ra);
+	dec = ln_deg_to_rad(state->equ.dec);
+	r = state->dist / EARTH_RADIUS * cos(dec);
+	z = state->dist / EARTH_RADIUS * sin(dec);
+
+	for (i = 0; i < n; i++) {
+		ln_get_earth_centre_dist(observers[i].height,
+			observers[i].posn.lat, &p_sin_o, &p_cos_o);
+
+		/* the Moon from the observer with x to the meridian and y to
+		 * the west in the equator, and z to the pole */
+		H = sidereal + ln_deg_to_rad(observers[i].posn.lng) - ra;
+		x = r * cos(H) - p_cos_o;
+		y = r * sin(H);
+		zt = z - p_sin_o;
+
+		topo[i].equ.ra = ln_range_degrees(ln_rad_to_deg(sidereal -
+			atan2(y, x)) + observers[i].posn.lng);
+		topo[i].equ.dec = ln_rad_to_deg(atan2(zt, sqrt(x * x + y * y)));
+		topo[i].dist = sqrt(x * x + y * y + zt * zt) * EARTH_RADIUS;
+
+		/* to the south and the zenith of the observer */
+		lat = ln_deg_to_rad(observers[i].posn.lat);
+		s = x * sin(lat) - zt * cos(lat);
+		u = x * cos(lat) + zt * sin(lat);
+
+		topo[i].hrz.az = ln_range_degrees(ln_rad_to_deg(atan2(y, s)));
+		topo[i].hrz.alt = ln_rad_to_deg(atan2(u, sqrt(s * s + y * y)));
+	}
+}
+
 /*! \fn double ln_get_lunar_rst(double JD, struct ln_lnlat_posn *observer, struct ln_rst_time *rst);
 * \param JD Julian day
 * \param observer Observers position
@@ -1283,12 +1497,16 @@ double ln_get_lunar_bright_limb(double JD)
 *
 * Note: this functions returns 1 if the Moon is circumpolar, that is it remains the whole
 * day either above or below the horizon.
+*
+* The Moon is calculated by ln_get_lunar_equ_coords_fast(), which changes the
+* times by no more than a few seconds. For the full ELP 2000-82B theory pass
+* ln_get_lunar_equ_coords() to ln_get_body_rst_horizon().
 */
 int ln_get_lunar_rst(double JD, const struct ln_lnlat_posn *observer,
 	struct ln_rst_time *rst)
 {
-	return ln_get_body_rst_horizon(JD, observer, ln_get_lunar_equ_coords,
-		LN_LUNAR_STANDART_HORIZON, rst);
+	return ln_get_body_rst_horizon(JD, observer,
+		ln_get_lunar_equ_coords_fast, LN_LUNAR_STANDART_HORIZON, rst);
 }
 
 /*! \fn double ln_get_lunar_sdiam(double JD)
@@ -1301,11 +1519,10 @@ int ln_get_lunar_rst(double JD, const struct ln_lnlat_posn *observer,
 */
 double ln_get_lunar_sdiam(double JD)
 {
-	double So = 358473400;
 	double dist;
 
 	dist = ln_get_lunar_earth_dist(JD);
-	return So / dist;
+	return LUNAR_SDIAM / dist;
 }
 
 /*! \fn double ln_get_lunar_long_asc_node(double JD);
@@ -1436,6 +1653,48 @@ void ln_get_lunar_subsolar_coords(double JD, struct ln_lnlat_posn *position)
 	ln_get_lunar_selenographic_coords(JD, &moon, position);
 }
 
+/* Julian Day of mean phase of quarter lunation q, 0 being the new moon of
+ * 2000 January 6 - Meeus equation 49.1 */
+static double mean_phase(double q)
+{
+	double k = q / 4.0, T = k / 1236.85;
+
+	return 2451550.09766 + 29.530588861 * k + 0.00015437 * T * T;
+}
+
+/* root of the phase function func for angle[0] by the secant method from x0
+ * and x1, reusing the value at each point */
+static double phase_root(double (*func)(double, double *), double x0,
+	double x1, double *angle)
+{
+	double f0, f1, x;
+	int i;
+
+	f0 = func(x0, angle);
+	for (i = 0; i < 100; i++) {
+		f1 = func(x1, angle);
+		if (f1 == f0)
+			break;
+		x = x1 - f1 * (x1 - x0) / (f1 - f0);
+		x0 = x1;
+		f0 = f1;
+		x1 = x;
+		if (fabs(x1 - x0) < 1e-6)
+			break;
+	}
+
+	return x1;
+}
+
+/* phase angle[0] near ph, bracketed by the abridged theory and refined
+ * by the full theories */
+static double phase_search(double ph, double *angle)
+{
+	ph = ln_find_zero(lunar_phase, ph, ph + 0.01, angle);
+
+	return phase_root(lunar_phase_elp, ph, ph + 0.001, angle);
+}
+
 /*
  * Notes on phase calculations.
  * In general, exact k cannot be easily computed (Meeus chapter 46 gives
@@ -1454,6 +1713,9 @@ void ln_get_lunar_subsolar_coords(double JD, struct ln_lnlat_posn *position)
 * \return Julian day when the moon will next be at the specified phase.
 *
 * Find next moon phase relative to given time expressed as Julian Day.
+* The phase is the instant the apparent longitudes of the Moon and Sun
+* differ by 360 degrees times phase. It is bracketed by the abridged lunar
+* theory and refined by the full ELP 2000-82B and VSOP87 theories.
 *
 */
 double ln_lunar_next_phase(double jd, double phase)
@@ -1468,7 +1730,7 @@ double ln_lunar_next_phase(double jd, double phase)
 
 	angle = 2.0 * M_PI * phase;
 
-	while ((ph = ln_find_zero(lunar_phase, ph, ph + 0.01, &angle)) < jd)
+	while ((ph = phase_search(ph, &angle)) < jd)
 		ph += 29.530588861;
 
 	return ph;
@@ -1480,6 +1742,7 @@ double ln_lunar_next_phase(double jd, double phase)
 * \return Julian day when the moon was last at the specified phase
 *
 * Find previous moon phase relative to given time expressed as Julian Day.
+* The phase is found as by ln_lunar_next_phase().
 *
 */
 double ln_lunar_previous_phase(double jd, double phase)
@@ -1494,12 +1757,117 @@ double ln_lunar_previous_phase(double jd, double phase)
 
 	angle = 2.0 * M_PI * phase;
 
-	while ((ph = ln_find_zero(lunar_phase, ph, ph + 0.01, &angle)) > jd)
+	while ((ph = phase_search(ph, &angle)) > jd)
 		ph -= 29.530588861;
 
 	return ph;
 }
 
+/* Phases in mask of the PHASE_YEAR quarter lunations from q0, which is a
+ * new moon, into jd[]. Each phase is bracketed by the cheap theories from
+ * the last one found, offset by the change of the mean phase, and then
+ * refined by the full theories. A quarter whose mean phase is outside from
+ * to to is left at its mean phase. */
+static void phase_year(double q0, int mask, double from, double to,
+	double *jd)
+{
+	double angle, seed, last = 0.0, qlast = q0 - 1.0;
+	int i;
+
+	for (i = 0; i < PHASE_YEAR; i++) {
+		if (!(mask & (1 << (i % 4))))
+			continue;
+
+		jd[i] = mean_phase(q0 + i);
+		if (jd[i] < from || jd[i] > to)
+			continue;
+
+		if (qlast < q0)
+			seed = jd[i];
+		else
+			seed = last + jd[i] - mean_phase(qlast);
+
+		angle = M_PI / 2.0 * (i % 4);
+		seed = phase_root(lunar_phase_bracket, seed, seed + 0.01, &angle);
+		jd[i] = phase_root(lunar_phase_elp, seed, seed + 0.001, &angle);
+
+		last = jd[i];
+		qlast = q0 + i;
+	}
+}
+
+/*! \fn int ln_lunar_phases_in_range(double JD0, double JD1, int mask, struct ln_lunar_phase *phases, int max)
+* \param JD0 Julian Day of the start of the range
+* \param JD1 Julian Day of the end of the range
+* \param mask LN_LUNAR_NEW_MOON, LN_LUNAR_FIRST_QUARTER, LN_LUNAR_FULL_MOON
+* and LN_LUNAR_LAST_QUARTER or'ed together, or LN_LUNAR_ALL_PHASES
+* \param phases Array to store the phases found
+* \param max Number of elements of phases
+* \return Number of phases stored
+* \ingroup lunar
+*
+* Find the phases in mask from JD0 up to but excluding JD1 in order of
+* time, stopping after max. A phase is the instant the apparent longitudes
+* of the Moon and Sun differ by 0, 90, 180 or 270 degrees, as in Meeus
+* chapter 49, by the full ELP 2000-82B and VSOP87 theories, as
+* ln_lunar_next_phase() finds them. The lunations are walked in order, each
+* phase being bracketed by the abridged lunar theory from the one before
+* it and refined with a few full positions.
+* With a library configured with --enable-threads the years of the range
+* are shared among the threads of ln_set_lunar_threads(). The phases are
+* the same whatever the number of threads.
+*/
+int ln_lunar_phases_in_range(double JD0, double JD1, int mask,
+	struct ln_lunar_phase *phases, int max)
+{
+	double jd[PHASE_YEARS * PHASE_YEAR];
+	double q0, phase_count;
+	int found = 0, i, y, years;
+
+	mask &= LN_LUNAR_ALL_PHASES;
+	if (mask == 0 || max <= 0 || JD1 <= JD0)
+		return 0;
+
+	phase_count = PHASE_YEAR / 4 * ((mask & 1) + (mask >> 1 & 1) +
+		(mask >> 2 & 1) + (mask >> 3 & 1));
+
+	/* true phases are within a day of the mean ones */
+	q0 = 4.0 * floor((JD0 - 2.0 - 2451550.09766) / 29.530588861);
+
+	while (found < max && mean_phase(q0) < JD1 + 2.0) {
+
+		/* years up to JD1 or to fill phases, whichever is fewer */
+		years = ceil((JD1 + 2.0 - mean_phase(q0)) /
+			(mean_phase(q0 + PHASE_YEAR) - mean_phase(q0)));
+		y = ceil((max - found) / phase_count) + 1;
+		if (years > y)
+			years = y;
+		if (years > PHASE_YEARS)
+			years = PHASE_YEARS;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(lunar_threads) \
+	if (lunar_threads > 1 && years > 1)
+#endif
+		for (y = 0; y < years; y++)
+			phase_year(q0 + y * PHASE_YEAR, mask, JD0 - 2.0,
+				JD1 + 2.0, &jd[y * PHASE_YEAR]);
+
+		for (i = 0; i < years * PHASE_YEAR && found < max; i++) {
+			if (!(mask & (1 << (i % 4))) || jd[i] < JD0 ||
+				jd[i] >= JD1)
+				continue;
+			phases[found].JD = jd[i];
+			phases[found].phase = (i % 4) / 4.0;
+			found++;
+		}
+
+		q0 += years * PHASE_YEAR;
+	}
+
+	return found;
+}
+
 /*! \fn double ln_lunar_next_apsis(double jd, int mode)
 * \param jd Julian Day
 * \param apogee 0 for perigee, 1 for apogee
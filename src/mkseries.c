@@ -0,0 +1,919 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+/* Build series_tables.c from the VSOP87 and ELP 2000-82B tables when the
+ * library is built. It holds the VSOP87 series sorted by amplitude with
+ * their cutoffs and A, B and C in separate arrays for the vector kernels,
+ * and the float series of the single precision kernels.
+ *
+ * For a library built with --enable-data-file the arrays, and the ELP
+ * tables themselves, go to a data file instead and series_tables.c only
+ * has the descriptors and a function for each body that points them into
+ * its section of the file. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include "vsop87-priv.h"
+#include "lunar-priv.h"
+#include "data-priv.h"
+#include "elp/elp.h"
+
+/* VSOP87 terms before cutoff[VSOP87_FLOAT_LEVEL] stay in double precision,
+ * leaving no more than 10^-VSOP87_FLOAT_LEVEL radians or AU of amplitude
+ * to the float kernels */
+#define VSOP87_FLOAT_LEVEL	4
+
+/* ELP terms stay in double precision until no more than ELP_FLOAT_TAIL
+ * arcsecs or km of amplitude is left for the float kernels */
+#define ELP_FLOAT_TAIL		1.0
+
+static const char *planet_names[] = {
+	"mercury", "venus", "earth", "mars",
+	"jupiter", "saturn", "uranus", "neptune",
+};
+
+static const struct vsop87_table *const planets[] = {
+	&mercury_table, &venus_table, &earth_table, &mars_table,
+	&jupiter_table, &saturn_table, &uranus_table, &neptune_table,
+};
+
+/* ELP 4 - 9 and 22 - 36 */
+static const struct earth_pert *const elp_earth[ELP_FLOAT_SERIES] = {
+	elp4, elp5, elp6, elp7, elp8, elp9,
+	NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+	elp22, elp23, elp24, elp25, elp26, elp27, elp28, elp29, elp30,
+	elp31, elp32, elp33, elp34, elp35, elp36,
+};
+
+/* ELP 10 - 21 */
+static const struct planet_pert *const elp_planet[ELP_FLOAT_SERIES] = {
+	NULL, NULL, NULL, NULL, NULL, NULL,
+	elp10, elp11, elp12, elp13, elp14, elp15,
+	elp16, elp17, elp18, elp19, elp20, elp21,
+};
+
+static const int elp_size[ELP_FLOAT_SERIES] = {
+	ELP4_SIZE, ELP5_SIZE, ELP6_SIZE, ELP7_SIZE, ELP8_SIZE, ELP9_SIZE,
+	ELP10_SIZE, ELP11_SIZE, ELP12_SIZE, ELP13_SIZE, ELP14_SIZE,
+	ELP15_SIZE, ELP16_SIZE, ELP17_SIZE, ELP18_SIZE, ELP19_SIZE,
+	ELP20_SIZE, ELP21_SIZE, ELP22_SIZE, ELP23_SIZE, ELP24_SIZE,
+	ELP25_SIZE, ELP26_SIZE, ELP27_SIZE, ELP28_SIZE, ELP29_SIZE,
+	ELP30_SIZE, ELP31_SIZE, ELP32_SIZE, ELP33_SIZE, ELP34_SIZE,
+	ELP35_SIZE, ELP36_SIZE,
+};
+
+static const char *elp_types[2] = {
+	"elp_main_term", "elp_pert_term",
+};
+
+/* a section of the data file being made */
+struct section
+{
+	char *data;
+	size_t size;
+};
+
+/* in data mode arrays go to sections[body] and the assignments that point
+ * descriptors at them to load, a temporary file */
+static int data_mode;
+static struct section sections[LN_BODIES];
+static int body;
+static FILE *load;
+
+/* append size bytes to the section of body, returning their offset */
+static size_t append_data(const void *data, size_t size)
+{
+	struct section *section = &sections[body];
+	size_t offset;
+
+	offset = (section->size + DATA_ARRAY_ALIGN - 1) / DATA_ARRAY_ALIGN *
+		DATA_ARRAY_ALIGN;
+	section->data = realloc(section->data, offset + size);
+	if (section->data == NULL) {
+		fprintf(stderr, "error: out of memory\n");
+		exit(-ENOMEM);
+	}
+
+	memset(section->data + section->size, 0, offset - section->size);
+	memcpy(section->data + offset, data, size);
+	section->size = offset + size;
+	return offset;
+}
+
+/* A pointer member of a descriptor at path, expr in series_tables.c. In
+ * data mode it is NULL until the load function of the body sets it. */
+static const char *member(const char *path, const char *expr)
+{
+	if (!data_mode || !strcmp(expr, "NULL"))
+		return expr;
+
+	fprintf(load, "\t%s = %s;\n", path, expr);
+	return "NULL";
+}
+
+/* round terms up to a multiple of pad */
+static int pad_terms(int terms, int pad)
+{
+	return (terms + pad - 1) / pad * pad;
+}
+
+static void *alloc(size_t size)
+{
+	void *data;
+
+	data = malloc(size > 0 ? size : 1);
+	if (data == NULL) {
+		fprintf(stderr, "error: out of memory\n");
+		exit(-ENOMEM);
+	}
+
+	return data;
+}
+
+/* Write one double column of terms first .. first + padded, zero past
+ * count, and store how series_tables.c refers to it in expr. */
+static void write_doubles(FILE *fdo, const char *name, const char *column,
+	const double *value, int first, int count, int padded, char *expr)
+{
+	double *column_data;
+	int i;
+
+	if (data_mode) {
+		column_data = alloc(padded * sizeof(double));
+		for (i = first; i < first + padded; i++)
+			column_data[i - first] = i < count ? value[3 * i] : 0.0;
+		sprintf(expr, "(const double *)(base + %lu)", (unsigned long)
+			append_data(column_data, padded * sizeof(double)));
+		free(column_data);
+		return;
+	}
+
+	fprintf(fdo, "static const double ALIGN32 %s_%s[%d] = {", name, column,
+		padded);
+	for (i = first; i < first + padded; i++) {
+		if ((i - first) % 2 == 0)
+			fprintf(fdo, "\n\t");
+		else
+			fprintf(fdo, " ");
+		fprintf(fdo, "%.17g,", i < count ? value[3 * i] : 0.0);
+	}
+	fprintf(fdo, "\n};\n\n");
+	sprintf(expr, "%s_%s", name, column);
+}
+
+/* Write one float column of terms first .. first + padded, zero past
+ * count, and store how series_tables.c refers to it in expr. */
+static void write_floats(FILE *fdo, const char *name, const char *column,
+	const double *value, int first, int count, int padded, char *expr)
+{
+	float *column_data;
+	int i;
+
+	if (data_mode) {
+		column_data = alloc(padded * sizeof(float));
+		for (i = first; i < first + padded; i++)
+			column_data[i - first] = i < count ? value[3 * i] : 0.0;
+		sprintf(expr, "(const float *)(base + %lu)", (unsigned long)
+			append_data(column_data, padded * sizeof(float)));
+		free(column_data);
+		return;
+	}
+
+	fprintf(fdo, "static const float ALIGN32 %s_%s[%d] = {", name, column,
+		padded);
+	for (i = first; i < first + padded; i++) {
+		if ((i - first) % 4 == 0)
+			fprintf(fdo, "\n\t");
+		else
+			fprintf(fdo, " ");
+		fprintf(fdo, "%.8ef,", i < count ? value[3 * i] : 0.0);
+	}
+	fprintf(fdo, "\n};\n\n");
+	sprintf(expr, "%s_%s", name, column);
+}
+
+/* how series_tables.c refers to the A, B and C arrays of a series */
+struct arrays
+{
+	char A[64];
+	char B[64];
+	char C[64];
+};
+
+/* Write the A, B and C arrays of the first padded terms, a multiple of
+ * VSOP87_PAD, in double precision. */
+static void write_double_series(FILE *fdo, const char *name,
+	const struct ln_vsop *terms, int count, int padded,
+	struct arrays *arrays)
+{
+	if (padded == 0) {
+		sprintf(arrays->A, "NULL");
+		sprintf(arrays->B, "NULL");
+		sprintf(arrays->C, "NULL");
+		return;
+	}
+
+	write_doubles(fdo, name, "A", &terms[0].A, 0, count, padded, arrays->A);
+	write_doubles(fdo, name, "B", &terms[0].B, 0, count, padded, arrays->B);
+	write_doubles(fdo, name, "C", &terms[0].C, 0, count, padded, arrays->C);
+}
+
+/* Write the float tables of a series of count terms sorted by decreasing
+ * amplitude, after the first heads in double precision in the arrays head,
+ * and save its struct float_series at path in desc. */
+static void write_float_series(FILE *fdo, const char *name,
+	const struct ln_vsop *terms, int count, const struct arrays *head,
+	int heads, const char *path, char *desc)
+{
+	char p[6][128];
+	struct arrays arrays;
+	int i, padded = 0;
+
+	if (count > heads)
+		padded = pad_terms(count - heads, FLOAT_SERIES_PAD);
+
+	sprintf(arrays.A, "NULL");
+	sprintf(arrays.B, "NULL");
+	sprintf(arrays.C, "NULL");
+	if (padded > 0) {
+		write_floats(fdo, name, "Af", &terms[0].A, heads, count, padded,
+			arrays.A);
+		write_floats(fdo, name, "Bf", &terms[0].B, heads, count, padded,
+			arrays.B);
+		write_floats(fdo, name, "Cf", &terms[0].C, heads, count, padded,
+			arrays.C);
+	}
+
+	i = 0;
+	sprintf(p[i++], "%s.head_A", path);
+	sprintf(p[i++], "%s.head_B", path);
+	sprintf(p[i++], "%s.head_C", path);
+	sprintf(p[i++], "%s.A", path);
+	sprintf(p[i++], "%s.B", path);
+	sprintf(p[i++], "%s.C", path);
+
+	sprintf(desc, "{%s, ", member(p[0], heads > 0 ? head->A : "NULL"));
+	sprintf(desc + strlen(desc), "%s, ",
+		member(p[1], heads > 0 ? head->B : "NULL"));
+	sprintf(desc + strlen(desc), "%s, %d, ",
+		member(p[2], heads > 0 ? head->C : "NULL"), heads);
+	sprintf(desc + strlen(desc), "%s, ", member(p[3], arrays.A));
+	sprintf(desc + strlen(desc), "%s, ", member(p[4], arrays.B));
+	sprintf(desc + strlen(desc), "%s, %d}", member(p[5], arrays.C), padded);
+}
+
+/* start the load function of body in data mode */
+static void begin_load(int section_body)
+{
+	body = section_body;
+	if (!data_mode)
+		return;
+
+	load = tmpfile();
+	if (load == NULL) {
+		fprintf(stderr, "error: cannot open temporary file\n");
+		exit(-errno);
+	}
+}
+
+/* write the load function of the body, after its descriptors */
+static void end_load(FILE *fdo, const char *name)
+{
+	char line[256];
+
+	if (!data_mode)
+		return;
+
+	fprintf(fdo, "static void load_%s(const char *base)\n{\n", name);
+	rewind(load);
+	while (fgets(line, sizeof(line), load))
+		fputs(line, fdo);
+	fprintf(fdo, "}\n\n");
+	fclose(load);
+}
+
+/* a term of a series to sort, its |A| and place in the tables */
+struct order
+{
+	double amplitude;
+	int index;
+};
+
+/* decreasing amplitude, terms of equal amplitude in the order of the
+ * tables as qsort() is not stable */
+static int cmp_order(const void *a, const void *b)
+{
+	const struct order *oa = a, *ob = b;
+
+	if (oa->amplitude != ob->amplitude)
+		return oa->amplitude < ob->amplitude ? 1 : -1;
+	return oa->index - ob->index;
+}
+
+/* sort order of count terms of amplitude[], which is sorted too */
+static struct order *sort_order(double *amplitude, int count)
+{
+	struct order *order;
+	int i;
+
+	order = alloc(count * sizeof(*order));
+	for (i = 0; i < count; i++) {
+		order[i].amplitude = fabs(amplitude[i]);
+		order[i].index = i;
+	}
+	qsort(order, count, sizeof(*order), cmp_order);
+
+	for (i = 0; i < count; i++)
+		amplitude[i] = order[i].amplitude;
+	return order;
+}
+
+/* sort terms by decreasing amplitude */
+static void sort_terms(struct ln_vsop *terms, int count)
+{
+	struct ln_vsop *sorted;
+	struct order *order;
+	double *amplitude;
+	int i;
+
+	amplitude = alloc(count * sizeof(*amplitude));
+	sorted = alloc(count * sizeof(*sorted));
+
+	for (i = 0; i < count; i++)
+		amplitude[i] = terms[i].A;
+	order = sort_order(amplitude, count);
+	for (i = 0; i < count; i++)
+		sorted[i] = terms[order[i].index];
+
+	memcpy(terms, sorted, count * sizeof(*terms));
+	free(order);
+	free(sorted);
+	free(amplitude);
+}
+
+/* Cutoffs of count sorted |A|, the fewest leading terms rounded up to a
+ * multiple of pad that leave no more than 10^(top - k) behind */
+static void get_cutoffs(const double *amplitude, int count, int levels,
+	int top, int pad, int *cutoff)
+{
+	double tail;
+	int k, n;
+
+	for (k = 0; k < levels; k++) {
+		tail = 0.0;
+		for (n = count; n > 0; n--) {
+			tail += amplitude[n - 1];
+			if (tail > pow(10.0, top - k))
+				break;
+		}
+		cutoff[k] = pad_terms(n, pad);
+		if (cutoff[k] > pad_terms(count, pad))
+			cutoff[k] = pad_terms(count, pad);
+	}
+}
+
+/* cutoffs of VSOP87 series of sorted terms */
+static void get_vsop87_cutoffs(const struct ln_vsop *terms, int count,
+	int *cutoff)
+{
+	double *amplitude;
+	int i;
+
+	amplitude = alloc(count * sizeof(*amplitude));
+	for (i = 0; i < count; i++)
+		amplitude[i] = fabs(terms[i].A);
+	get_cutoffs(amplitude, count, VSOP87_LEVELS, 0, VSOP87_PAD, cutoff);
+	free(amplitude);
+}
+
+static void write_planet(FILE *fdo, int planet)
+{
+	const struct vsop87_table_coord *coord[3] = {&planets[planet]->L,
+		&planets[planet]->B, &planets[planet]->R};
+	const char *coord_names = "lbr", *coord_members = "LBR";
+	const struct vsop87_table_series *series;
+	struct ln_vsop *terms;
+	struct arrays arrays[3][VSOP87_POWERS];
+	char name[64], path[64], fdesc[3][VSOP87_POWERS][512];
+	char A[128], B[128], C[128];
+	int cutoff[3][VSOP87_POWERS][VSOP87_LEVELS];
+	int padded[3][VSOP87_POWERS];
+	int i, j, k;
+
+	begin_load(planet);
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < coord[i]->powers; j++) {
+			series = &coord[i]->series[j];
+			sprintf(name, "%s_%c%d", planet_names[planet],
+				coord_names[i], j);
+
+			terms = alloc(series->count * sizeof(*terms));
+			memcpy(terms, series->terms,
+				series->count * sizeof(*terms));
+			sort_terms(terms, series->count);
+			get_vsop87_cutoffs(terms, series->count, cutoff[i][j]);
+			padded[i][j] = pad_terms(series->count, VSOP87_PAD);
+
+			write_double_series(fdo, name, terms, series->count,
+				padded[i][j], &arrays[i][j]);
+
+			/* the float series shares the double head */
+			sprintf(path, "%s_float.%c.series[%d]",
+				planet_names[planet], coord_members[i], j);
+			write_float_series(fdo, name, terms, series->count,
+				&arrays[i][j], cutoff[i][j][VSOP87_FLOAT_LEVEL],
+				path, fdesc[i][j]);
+			free(terms);
+		}
+	}
+
+	fprintf(fdo, "SERIES_CONST struct vsop87_planet %s_vsop87 = {\n",
+		planet_names[planet]);
+	for (i = 0; i < 3; i++) {
+		fprintf(fdo, "\t{%d, {\n", coord[i]->powers);
+		for (j = 0; j < coord[i]->powers; j++) {
+			sprintf(path, "%s_vsop87.%c.series[%d]",
+				planet_names[planet], coord_members[i], j);
+			sprintf(A, "%s.A", path);
+			sprintf(B, "%s.B", path);
+			sprintf(C, "%s.C", path);
+			fprintf(fdo, "\t\t{%s, ", member(A, arrays[i][j].A));
+			fprintf(fdo, "%s, ", member(B, arrays[i][j].B));
+			fprintf(fdo, "%s, %d, {", member(C, arrays[i][j].C),
+				padded[i][j]);
+			for (k = 0; k < VSOP87_LEVELS; k++)
+				fprintf(fdo, k ? ", %d" : "%d", cutoff[i][j][k]);
+			fprintf(fdo, "}},\n");
+		}
+		fprintf(fdo, "\t}},\n");
+	}
+	fprintf(fdo, "\t%d,\n};\n\n", planet);
+
+	fprintf(fdo, "SERIES_CONST struct float_planet %s_float = {\n",
+		planet_names[planet]);
+	for (i = 0; i < 3; i++) {
+		fprintf(fdo, "\t{%d, {\n", coord[i]->powers);
+		for (j = 0; j < coord[i]->powers; j++)
+			fprintf(fdo, "\t\t%s,\n", fdesc[i][j]);
+		fprintf(fdo, "\t}},\n");
+	}
+	fprintf(fdo, "\t%d,\n};\n\n", planet);
+
+	end_load(fdo, planet_names[planet]);
+}
+
+/* ELP term A * sin(phase + freq * t) as A * cos(B + C * t), B in 0 .. 2PI */
+static void set_elp_term(struct ln_vsop *term, double A, double phase,
+	double freq)
+{
+	term->A = A;
+	term->B = fmod(phase - M_PI_2, 2.0 * M_PI);
+	if (term->B < 0.0)
+		term->B += 2.0 * M_PI;
+	term->C = freq;
+}
+
+/* multiplier of fundamental argument i, which must be a small integer */
+static int get_multiplier(double n, int i, int k, int j)
+{
+	if (n != floor(n) || fabs(n) > elp_mult_max[i]) {
+		fprintf(stderr, "error: ELP%d term %d multiplier %g\n",
+			k + ELP_FLOAT_FIRST, j, n);
+		exit(-EINVAL);
+	}
+	return (int)n;
+}
+
+/* ELP 4 - 36 term of the fundamental arguments of lunar-priv.h */
+struct pert_term
+{
+	double A;
+	double phase;
+	int n[ELP_ARGS];
+};
+
+#define MULT(i, x)	get_multiplier(x, i, k, j)
+
+/* term j of elp_earth[k] or elp_planet[k] */
+static void get_pert_term(int k, int j, struct pert_term *term)
+{
+	const struct earth_pert *e;
+	const struct planet_pert *pp;
+	int i;
+
+	memset(term, 0, sizeof(*term));
+
+	if (elp_earth[k]) {
+		e = &elp_earth[k][j];
+		term->A = e->A;
+		term->phase = e->O * DEG;
+		for (i = 0; i < 4; i++)
+			term->n[ELP_ARG_DEL + i] = MULT(ELP_ARG_DEL + i, e->ilu[i]);
+		term->n[ELP_ARG_ZETA] = MULT(ELP_ARG_ZETA, e->iz);
+		return;
+	}
+
+	pp = &elp_planet[k][j];
+	term->A = pp->O;
+	term->phase = pp->theta * DEG;
+	if (k + ELP_FLOAT_FIRST <= 15) {
+		/* ELP 10 - 15, no l' */
+		for (i = 0; i < 8; i++)
+			term->n[i] = MULT(i, pp->ipla[i]);
+		term->n[ELP_ARG_DEL] = MULT(ELP_ARG_DEL, pp->ipla[8]);
+		term->n[ELP_ARG_DEL + 2] = MULT(ELP_ARG_DEL + 2, pp->ipla[9]);
+		term->n[ELP_ARG_DEL + 3] = MULT(ELP_ARG_DEL + 3, pp->ipla[10]);
+	} else {
+		/* ELP 16 - 21, no Neptune */
+		for (i = 0; i < 7; i++)
+			term->n[i] = MULT(i, pp->ipla[i]);
+		for (i = 0; i < 4; i++)
+			term->n[ELP_ARG_DEL + i] =
+				MULT(ELP_ARG_DEL + i, pp->ipla[i + 7]);
+	}
+}
+
+#undef MULT
+
+/* term j of elp_earth[k] or elp_planet[k] as the product of powers,
+ * returning its amplitude */
+static double get_pert_factors(int k, int j, struct elp_pert_term *pert)
+{
+	struct pert_term term;
+	int i;
+
+	get_pert_term(k, j, &term);
+	memset(pert, 0, sizeof(*pert));
+	pert->C = term.A * cos(term.phase);
+	pert->S = term.A * sin(term.phase);
+
+	for (i = 0; i < ELP_ARGS; i++) {
+		if (term.n[i] == 0)
+			continue;
+		if (pert->factors == ELP_FACTORS) {
+			fprintf(stderr, "error: ELP%d term %d has more than "
+				"%d arguments\n", k + ELP_FLOAT_FIRST, j,
+				ELP_FACTORS);
+			exit(-EINVAL);
+		}
+		pert->power[pert->factors++] = elp_power_index(i, term.n[i]);
+	}
+
+	if (pert->factors == 0)
+		pert->power[pert->factors++] = elp_power_index(0, 0);
+
+	return fabs(term.A);
+}
+
+/* the arguments of ELP 4 - 36, linear in t */
+static void get_elp_terms(int k, struct ln_vsop *terms)
+{
+	struct pert_term term;
+	double y[2];
+	int i, j, n;
+
+	for (j = 0; j < elp_size[k]; j++) {
+		get_pert_term(k, j, &term);
+		for (n = 0; n < 2; n++) {
+			y[n] = 0.0;
+			for (i = 0; i < ELP_ARGS; i++)
+				y[n] += term.n[i] * elp_arg(i, n);
+		}
+		set_elp_term(&terms[j], term.A, term.phase + y[0], y[1]);
+	}
+}
+
+/* ELP 1 - 3 term folded to its amplitude with the corrections for
+ * DE200 / LE200 and the polynomial in t of its argument. The cosines of
+ * ELP 3 are written as sines of the argument plus PI / 2. */
+static void get_main_term(const struct main_problem *term, int series,
+	struct elp_main_term *main)
+{
+	double tgv;
+	int i, k;
+
+	tgv = term->B[0] + DTASM * term->B[4];
+	main->A = term->A + tgv * (DELNP - AM * DELNU) + term->B[1] * DELG +
+		term->B[2] * DELE + term->B[3] * DELEP;
+
+	for (k = 0; k < 5; k++) {
+		main->arg[k] = 0.0;
+		for (i = 0; i < 4; i++)
+			main->arg[k] += term->ilu[i] * del[i][k];
+	}
+	if (series == 2)
+		main->arg[0] += M_PI_2;
+}
+
+static void write_values(FILE *fdo, const double *value, int count)
+{
+	int i;
+
+	fprintf(fdo, "{");
+	for (i = 0; i < count; i++)
+		fprintf(fdo, i ? ", %.17g" : "%.17g", value[i]);
+	fprintf(fdo, "}");
+}
+
+/* ELP term in the layout of lunar-priv.h */
+static void write_elp_term(FILE *fdo, int type, const void *term)
+{
+	const struct elp_main_term *m = term;
+	const struct elp_pert_term *e = term;
+	int i;
+
+	fprintf(fdo, "\t{");
+	if (type == 0) {
+		fprintf(fdo, "%.17g, ", m->A);
+		write_values(fdo, m->arg, 5);
+	} else {
+		fprintf(fdo, "%.17g, %.17g, {", e->C, e->S);
+		for (i = 0; i < e->factors; i++)
+			fprintf(fdo, i ? ", %d" : "%d", e->power[i]);
+		fprintf(fdo, "}, %d", e->factors);
+	}
+	fprintf(fdo, "},\n");
+}
+
+/* Write the 36 ELP tables sorted by decreasing amplitude with their
+ * cutoffs, to series_tables.c or in data mode the section of the Moon. */
+static void write_elp_series(FILE *fdo)
+{
+	static const size_t term_size[2] = {sizeof(struct elp_main_term),
+		sizeof(struct elp_pert_term)};
+	static const char *members[2] = {"main", "pert"};
+	const struct main_problem *source;
+	struct elp_main_term *main = NULL;
+	struct elp_pert_term *pert = NULL;
+	const char *table;
+	struct order *order;
+	double *amplitude;
+	char *sorted, path[64], expr[ELP_SERIES][64];
+	int cutoff[ELP_SERIES][ELP_LEVELS], count[ELP_SERIES], type[ELP_SERIES];
+	int i, j, k;
+
+	if (elp_power_index(ELP_ARGS - 1, elp_mult_max[ELP_ARGS - 1]) + 1 !=
+		ELP_POWERS) {
+		fprintf(stderr, "error: ELP_POWERS does not match elp_mult_max\n");
+		exit(-EINVAL);
+	}
+
+	for (k = 0; k < ELP_SERIES; k++) {
+		amplitude = NULL;
+		if (k < 3) {
+			source = k == 0 ? elp1 : k == 1 ? elp2 : elp3;
+			count[k] = k == 0 ? ELP1_SIZE : k == 1 ? ELP2_SIZE :
+				ELP3_SIZE;
+			main = alloc(count[k] * sizeof(*main));
+			amplitude = alloc(count[k] * sizeof(*amplitude));
+			for (j = 0; j < count[k]; j++) {
+				get_main_term(&source[j], k, &main[j]);
+				amplitude[j] = main[j].A;
+			}
+			table = (const char *)main;
+			type[k] = 0;
+		} else {
+			count[k] = elp_size[k - 3];
+			pert = alloc(count[k] * sizeof(*pert));
+			amplitude = alloc(count[k] * sizeof(*amplitude));
+			for (j = 0; j < count[k]; j++)
+				amplitude[j] = get_pert_factors(k - 3, j, &pert[j]);
+			table = (const char *)pert;
+			type[k] = 1;
+		}
+
+		order = sort_order(amplitude, count[k]);
+		get_cutoffs(amplitude, count[k], ELP_LEVELS, ELP_LEVEL_TOP, 1,
+			cutoff[k]);
+
+		sorted = alloc(count[k] * term_size[type[k]]);
+		for (j = 0; j < count[k]; j++)
+			memcpy(sorted + j * term_size[type[k]],
+				table + order[j].index * term_size[type[k]],
+				term_size[type[k]]);
+
+		if (data_mode) {
+			sprintf(expr[k], "(const struct %s *)(base + %lu)",
+				elp_types[type[k]], (unsigned long)append_data(sorted,
+				count[k] * term_size[type[k]]));
+		} else {
+			sprintf(expr[k], "elp%d_sorted", k + 1);
+			fprintf(fdo, "static const struct %s %s[%d] = {\n",
+				elp_types[type[k]], expr[k], count[k]);
+			for (j = 0; j < count[k]; j++)
+				write_elp_term(fdo, type[k],
+					sorted + j * term_size[type[k]]);
+			fprintf(fdo, "};\n\n");
+		}
+
+		free(sorted);
+		free(order);
+		free(amplitude);
+		free((void *)table);
+	}
+
+	fprintf(fdo, "SERIES_CONST struct elp_series elp_series[ELP_SERIES] = {\n");
+	for (k = 0; k < ELP_SERIES; k++) {
+		sprintf(path, "elp_series[%d].%s", k, members[type[k]]);
+		fprintf(fdo, "\t{");
+		for (i = 0; i < 2; i++)
+			fprintf(fdo, "%s, ", i == type[k] ?
+				member(path, expr[k]) : "NULL");
+		fprintf(fdo, "%d, {", count[k]);
+		for (i = 0; i < ELP_LEVELS; i++)
+			fprintf(fdo, i ? ", %d" : "%d", cutoff[k][i]);
+		fprintf(fdo, "}},\n");
+	}
+	fprintf(fdo, "};\n\n");
+}
+
+static void write_elp(FILE *fdo)
+{
+	struct ln_vsop *terms;
+	struct arrays head;
+	char name[64], path[64], desc[ELP_FLOAT_SERIES][512];
+	double tail;
+	int k, heads;
+
+	begin_load(LN_BODY_MOON);
+	write_elp_series(fdo);
+
+	for (k = 0; k < ELP_FLOAT_SERIES; k++) {
+		terms = alloc(elp_size[k] * sizeof(*terms));
+		get_elp_terms(k, terms);
+		sort_terms(terms, elp_size[k]);
+
+		/* fewest leading terms leaving no more than ELP_FLOAT_TAIL */
+		tail = 0.0;
+		for (heads = elp_size[k]; heads > 0; heads--) {
+			tail += fabs(terms[heads - 1].A);
+			if (tail > ELP_FLOAT_TAIL)
+				break;
+		}
+
+		/* whole vectors of heads for the double kernels */
+		heads = pad_terms(heads, VSOP87_PAD);
+		if (heads > elp_size[k])
+			heads = elp_size[k];
+
+		sprintf(name, "elp%d", k + ELP_FLOAT_FIRST);
+		sprintf(path, "elp_float[%d]", k);
+		write_double_series(fdo, name, terms, heads,
+			pad_terms(heads, VSOP87_PAD), &head);
+		write_float_series(fdo, name, terms, elp_size[k], &head, heads,
+			path, desc[k]);
+		free(terms);
+	}
+
+	fprintf(fdo, "SERIES_CONST struct float_series "
+		"elp_float[ELP_FLOAT_SERIES] = {\n");
+	for (k = 0; k < ELP_FLOAT_SERIES; k++)
+		fprintf(fdo, "\t%s,\n", desc[k]);
+	fprintf(fdo, "};\n\n");
+
+	end_load(fdo, "moon");
+}
+
+/* the loaders of series_tables.c and the sections they were made for */
+static void write_loaders(FILE *fdo)
+{
+	int i;
+
+	fprintf(fdo, "const struct data_loader data_loaders[LN_BODIES] = {\n");
+	for (i = 0; i < LN_BODIES; i++) {
+		if (i < LN_BODY_PLUTO)
+			fprintf(fdo, "\t{%lu, load_%s},\n",
+				(unsigned long)sections[i].size, planet_names[i]);
+		else if (i == LN_BODY_MOON)
+			fprintf(fdo, "\t{%lu, load_moon},\n",
+				(unsigned long)sections[i].size);
+		else
+			fprintf(fdo, "\t{0, NULL},\n");
+	}
+	fprintf(fdo, "};\n");
+}
+
+/* header, section table and the sections at multiples of DATA_ALIGN */
+static void write_data(const char *file)
+{
+	struct data_header header;
+	struct data_section section[LN_BODIES];
+	uint64_t offset;
+	FILE *fdo;
+	int i;
+
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, DATA_MAGIC, sizeof(header.magic));
+	header.byte_order = DATA_BYTE_ORDER;
+	header.version = DATA_VERSION;
+	header.sections = LN_BODIES;
+	header.align = DATA_ALIGN;
+
+	offset = DATA_ALIGN;
+	for (i = 0; i < LN_BODIES; i++) {
+		section[i].offset = sections[i].size ? offset : 0;
+		section[i].size = sections[i].size;
+		offset += (sections[i].size + DATA_ALIGN - 1) / DATA_ALIGN *
+			DATA_ALIGN;
+	}
+
+	fdo = fopen(file, "wb");
+	if (fdo == NULL) {
+		fprintf(stderr, "error: cannot open data file %s\n", file);
+		exit(-errno);
+	}
+
+	fwrite(&header, sizeof(header), 1, fdo);
+	fwrite(section, sizeof(section), 1, fdo);
+	for (i = 0; i < LN_BODIES; i++) {
+		if (sections[i].size == 0)
+			continue;
+		if (fseek(fdo, section[i].offset, SEEK_SET) < 0)
+			break;
+		fwrite(sections[i].data, 1, sections[i].size, fdo);
+	}
+
+	if (i < LN_BODIES || fclose(fdo)) {
+		fprintf(stderr, "error: cannot write data file %s\n", file);
+		exit(-errno);
+	}
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-d data file] output.c\n", prog);
+	exit(-EINVAL);
+}
+
+int main(int argc, char *argv[])
+{
+	const char *data_file = NULL;
+	FILE *fdo;
+	int i, opt;
+
+	while ((opt = getopt(argc, argv, "d:h")) != -1) {
+		switch (opt) {
+		case 'd':
+			data_file = optarg;
+			data_mode = 1;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	if (optind != argc - 1)
+		usage(argv[0]);
+
+	fdo = fopen(argv[optind], "w");
+	if (fdo == NULL) {
+		fprintf(stderr, "error: cannot open output file %s\n",
+			argv[optind]);
+		exit(-errno);
+	}
+
+	fprintf(fdo, "/* Made by mkseries from the VSOP87 and ELP 2000-82B "
+		"tables, do not edit. */\n\n");
+	fprintf(fdo, "#include <stddef.h>\n");
+	fprintf(fdo, "#include \"vsop87-priv.h\"\n");
+	fprintf(fdo, "#include \"lunar-priv.h\"\n");
+	if (data_mode) {
+		fprintf(fdo, "#include \"data-priv.h\"\n");
+	}
+	fprintf(fdo, "\n");
+
+	for (i = 0; i < (int)(sizeof(planets) / sizeof(planets[0])); i++)
+		write_planet(fdo, i);
+	write_elp(fdo);
+
+	if (data_mode) {
+		write_loaders(fdo);
+		write_data(data_file);
+	}
+
+	if (fclose(fdo)) {
+		fprintf(stderr, "error: cannot write output file %s\n",
+			argv[optind]);
+		exit(-errno);
+	}
+
+	return 0;
+}
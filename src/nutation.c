@@ -20,6 +20,7 @@
 #include <libnova/nutation.h>
 #include <libnova/dynamical_time.h>
 #include <libnova/utility.h>
+#include "cache-priv.h"
 
 #define TERMS 63
 #define LN_NUTATION_EPOCH_THRESHOLD 0.1
@@ -172,8 +173,53 @@ const static struct nutation_coefficients coefficients[TERMS] = {
     {-3.0,	0.0,	0.0,	0.0}};
 
 /* cache values */
-static long double c_JD = 0.0, c_longitude = 0.0, c_obliquity = 0.0,
-	c_ecliptic = 0.0;
+struct nutation_cache {
+	long double JD[LN_CACHE_ENTRIES];
+	long double longitude[LN_CACHE_ENTRIES];
+	long double obliquity[LN_CACHE_ENTRIES];
+	long double ecliptic[LN_CACHE_ENTRIES];
+	int valid;	/* entries in use */
+	int next;	/* entry to replace next */
+};
+
+static LN_THREAD_LOCAL struct nutation_cache cache;
+
+/* find the cached epoch for JD. The newest is reused within
+ * LN_NUTATION_EPOCH_THRESHOLD of JD, as by the single epoch cache, and
+ * older ones only for the same JD. */
+static int nutation_cache_find(double JD)
+{
+	int i, entry = cache.next;
+
+	for (i = 0; i < cache.valid; i++) {
+		if (--entry < 0)
+			entry = LN_CACHE_ENTRIES - 1;
+		if (i == 0 ?
+			fabsl(JD - cache.JD[entry]) <= LN_NUTATION_EPOCH_THRESHOLD :
+			cache.JD[entry] == JD)
+			return entry;
+	}
+
+	return -1;
+}
+
+/* save the nutation at JD as the newest epoch, returns its entry */
+static int nutation_cache_put(double JD, long double longitude,
+	long double obliquity, long double ecliptic)
+{
+	int entry = cache.next;
+
+	cache.JD[entry] = JD;
+	cache.longitude[entry] = longitude;
+	cache.obliquity[entry] = obliquity;
+	cache.ecliptic[entry] = ecliptic;
+	if (cache.valid < LN_CACHE_ENTRIES)
+		cache.valid++;
+	if (++cache.next == LN_CACHE_ENTRIES)
+		cache.next = 0;
+
+	return entry;
+}
 
 	
 /*! \fn void ln_get_nutation(double JD, struct ln_nutation *nutation)
@@ -192,12 +238,13 @@ void ln_get_nutation(double JD, struct ln_nutation *nutation)
 	long double D, M, MM, F, O, T, T2, T3, JDE;
 	long double coeff_sine, coeff_cos;
 	long double argument;
-	int i;
+	long double c_longitude, c_obliquity, c_ecliptic;
+	int i, entry;
 
 	/* should we bother recalculating nutation */
-	if (fabsl(JD - c_JD) > LN_NUTATION_EPOCH_THRESHOLD) {
+	entry = nutation_cache_find(JD);
+	if (entry < 0) {
 		/* set the new epoch */
-		c_JD = JD;
 		c_longitude = 0;
 		c_obliquity = 0;
 
@@ -258,12 +305,36 @@ void ln_get_nutation(double JD, struct ln_nutation *nutation)
 		/* c_ecliptic += c_obliquity; * Uncomment this if function should 
                                          return true obliquity rather than
                                          mean obliquity */
+
+		entry = nutation_cache_put(JD, c_longitude, c_obliquity,
+			c_ecliptic);
+	} else if (entry != (cache.next + LN_CACHE_ENTRIES - 1) % LN_CACHE_ENTRIES) {
+		/* an older epoch used again becomes the newest */
+		entry = nutation_cache_put(JD, cache.longitude[entry],
+			cache.obliquity[entry], cache.ecliptic[entry]);
 	}
 
 	/* return results */
-	nutation->longitude = c_longitude;
-	nutation->obliquity = c_obliquity;
-	nutation->ecliptic = c_ecliptic;
+	nutation->longitude = cache.longitude[entry];
+	nutation->obliquity = cache.obliquity[entry];
+	nutation->ecliptic = cache.ecliptic[entry];
+}
+
+/*! \fn void ln_get_nutation_ctx(struct ln_ctx *ctx, struct ln_nutation *nutation)
+* \param ctx Epoch context
+* \param nutation Pointer to store nutation
+*
+* Calculate nutation for the epoch of ctx, as ln_get_nutation(). The
+* result is kept in ctx for later calls.
+*/
+void ln_get_nutation_ctx(struct ln_ctx *ctx, struct ln_nutation *nutation)
+{
+	if (!(ctx->valid & LN_CTX_NUTATION)) {
+		ln_get_nutation(ctx->JD, &ctx->nutation);
+		ctx->valid |= LN_CTX_NUTATION;
+	}
+
+	*nutation = ctx->nutation;
 }
 
 /*! \fn void ln_get_equ_nut(struct ln_equ_posn *mean_position, double JD, struct ln_equ_posn *position)
@@ -0,0 +1,142 @@
+/*
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+ */
+
+#include <string.h>
+#include <libnova/planets.h>
+#include <libnova/solar.h>
+#include <libnova/earth.h>
+#include <libnova/pluto.h>
+#include <libnova/transform.h>
+#include <libnova/context.h>
+#include "vsop87-priv.h"
+#include "light_time-priv.h"
+
+static const struct vsop87_planet *const planet_vsop87[LN_BODY_MOON] = {
+	&mercury_vsop87,
+	&venus_vsop87,
+	NULL,
+	&mars_vsop87,
+	&jupiter_vsop87,
+	&saturn_vsop87,
+	&uranus_vsop87,
+	&neptune_vsop87,
+	NULL,
+};
+
+static const struct float_planet *const planet_float[LN_BODY_MOON] = {
+	&mercury_float,
+	&venus_float,
+	&earth_float,
+	&mars_float,
+	&jupiter_float,
+	&saturn_float,
+	&uranus_float,
+	&neptune_float,
+	NULL,
+};
+
+/* one planet other than the Earth from its position and velocity */
+static void get_planet(int body, double JD, const struct ln_rect_posn *g_sol,
+	struct ln_planet_snapshot *out)
+{
+	struct ln_rect_posn r, v;
+
+	if (body == LN_BODY_PLUTO) {
+		ln_get_pluto_helio_coords(JD, &out->helio);
+		pluto_get_rect_posvel(JD, &r, &v);
+	} else
+		vsop87_get_rect_posvel(planet_vsop87[body], JD, &r, &v,
+			&out->helio);
+
+	light_time_geo_rect(g_sol, &r, &v, &out->geo);
+	light_time_equ_from_geo(&out->geo, &out->equ);
+}
+
+/*! \fn int ln_get_planets_snapshot(double JD, unsigned int mask, struct ln_planet_snapshot *out)
+* \param JD Julian Day
+* \param mask LN_BODY_MASK() bits of the planets wanted, or LN_PLANETS_MASK
+* \param out Array of LN_BODY_MOON positions indexed by LN_BODY_ number
+* \return Number of planets calculated or -1 if mask has a bit that is not
+* a planet.
+*
+* Calculate the heliocentric, geocentric and equatorial positions of the
+* planets in mask for JD. Entries of out for planets not in mask are left
+* alone. The positions agree with the planets' helio_coords and equ_coords
+* functions. For the Earth only the heliocentric position is set.
+*/
+int ln_get_planets_snapshot(double JD, unsigned int mask,
+	struct ln_planet_snapshot *out)
+{
+	struct ln_ctx ctx;
+	struct ln_helio_posn h_sol;
+	struct ln_rect_posn g_sol;
+	int body[LN_BODY_MOON], planets = 0, i;
+
+	if (mask & ~LN_PLANETS_MASK)
+		return -1;
+
+	/* the Earth once for every planet */
+	ln_ctx_init(&ctx, JD);
+	ln_get_solar_geom_coords_ctx(&ctx, &h_sol);
+	ln_get_rect_from_helio(&h_sol, &g_sol);
+
+	if (mask & LN_BODY_MASK(LN_BODY_EARTH)) {
+		memset(&out[LN_BODY_EARTH], 0, sizeof(out[LN_BODY_EARTH]));
+		ln_get_earth_helio_coords_ctx(&ctx, &out[LN_BODY_EARTH].helio);
+	}
+
+	for (i = 0; i < LN_BODY_MOON; i++) {
+		if (i != LN_BODY_EARTH && (mask & LN_BODY_MASK(i)))
+			body[planets++] = i;
+	}
+
+	/* position caches are per thread so planets can be shared out */
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (planets > 1)
+#endif
+	for (i = 0; i < planets; i++)
+		get_planet(body[i], JD, &g_sol, &out[body[i]]);
+
+	return planets + ((mask & LN_BODY_MASK(LN_BODY_EARTH)) ? 1 : 0);
+}
+
+/*! \fn int ln_get_planet_helio_coords_float(int body, double JD, struct ln_helio_posn *position)
+* \param body Planet, LN_BODY_MERCURY to LN_BODY_NEPTUNE
+* \param JD Julian Day
+* \param position Pointer to store heliocentric position
+* \return 0 or -1 if body is not a VSOP87 planet.
+*
+* Calculate the heliocentric position of a planet as its helio_coords
+* function, for drawing the sky or screening for events. The largest
+* terms of each VSOP87 series are summed in double precision and the rest,
+* no more than 1e-4 radians or AU of amplitude, in single precision with
+* twice as many terms to a vector.
+*
+* The error of a series is no more than the amplitude summed in single
+* precision times the error of a float argument, about 6e-8 of B + C * t,
+* so it grows with the time from J2000. L and B are within 0.01 arcsecs
+* and R within 1.5e-7 of itself of the double precision series between
+* 1900 and 2100, and within 0.15 arcsecs and 1.5e-6 between 1000 and 3000.
+*/
+int ln_get_planet_helio_coords_float(int body, double JD,
+	struct ln_helio_posn *position)
+{
+	if (body < 0 || body >= LN_BODY_MOON || planet_float[body] == NULL)
+		return -1;
+
+	vsop87_get_helio_coords_float(planet_float[body], JD, position);
+	return 0;
+}
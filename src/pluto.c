@@ -25,6 +25,9 @@
 #include <libnova/transform.h>
 #include <libnova/rise_set.h>
 #include <libnova/utility.h>
+#include <libnova/context.h>
+#include "cache-priv.h"
+#include "light_time-priv.h"
 
 #define PLUTO_COEFFS 43
 
@@ -45,7 +48,7 @@ struct pluto_radius {
 };
 
 /* cache variables */
-static double cJD = 0.0, cL = 0.0, cB = 0.0, cR = 0.0;
+static LN_THREAD_LOCAL struct helio_cache cache;
 
 static const struct pluto_argument argument[PLUTO_COEFFS] = {
 	{0, 0, 1},
@@ -241,38 +244,78 @@ static const struct pluto_radius radius[PLUTO_COEFFS] = {
 */ 
 void ln_get_pluto_equ_coords(double JD, struct ln_equ_posn *position)
 {
-	struct ln_helio_posn h_sol, h_pluto;
-	struct ln_rect_posn g_sol, g_pluto;
-	double a,b,c;
-	double ra, dec, delta, diff, last, t = 0;
-	
-	/* need typdef for solar heliocentric coords */
-	ln_get_solar_geom_coords(JD, &h_sol);
-	ln_get_rect_from_helio(&h_sol,  &g_sol);
-	
-	do {
-		last = t;
-		ln_get_pluto_helio_coords(JD - t, &h_pluto);
-		ln_get_rect_from_helio(&h_pluto, &g_pluto);
-
-		/* equ 33.10 pg 229 */
-		a = g_sol.X + g_pluto.X;
-		b = g_sol.Y + g_pluto.Y;
-		c = g_sol.Z + g_pluto.Z;
-	
-		delta = a * a + b * b + c * c;
-		delta = sqrt(delta);
-		t = delta * 0.0057755183;
-		diff = t - last;
-	} while (diff > 0.0001 || diff < -0.0001);
-		
-	ra = atan2(b, a);
-	dec = c / delta;
-	dec = asin(dec);
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	ln_get_pluto_equ_coords_ctx(&ctx, position);
+}
+
+/* Heliocentric rectangular position and velocity for the light time. The
+ * position is ln_get_rect_from_helio() of ln_get_pluto_helio_coords() and
+ * the velocity is from the derivatives of the terms of table 37.A. */
+void pluto_get_rect_posvel(double JD, struct ln_rect_posn *position,
+	struct ln_rect_posn *velocity)
+{
+	struct ln_helio_posn h_pluto;
+	double rate_L = 0, rate_B = 0, rate_R = 0;
+	double J, S, P, t, a, da, sin_a, cos_a;
+	double sin_L, cos_L, sin_B, cos_B, dL, dB, dR, x, y, z;
+	int i;
+
+	ln_get_pluto_helio_coords(JD, &h_pluto);
+	ln_get_rect_from_helio(&h_pluto, position);
+
+	t = (JD - 2451545.0) / 36525.0;
+	J =  34.35 + 3034.9057 * t;
+	S =  50.08 + 1222.1138 * t;
+	P = 238.96 +  144.9600 * t;
+
+	/* d/dt of the table 37.A terms, t in centuries */
+	for (i = 0; i < PLUTO_COEFFS; i++) {
+		a = argument[i].J * J + argument[i].S * S + argument[i].P * P;
+		da = ln_deg_to_rad(argument[i].J * 3034.9057 +
+			argument[i].S * 1222.1138 + argument[i].P * 144.96);
+		sin_a = sin(ln_deg_to_rad(a));
+		cos_a = cos(ln_deg_to_rad(a));
+
+		rate_L += (longitude[i].A * cos_a - longitude[i].B * sin_a) * da;
+		rate_B += (latitude[i].A * cos_a - latitude[i].B * sin_a) * da;
+		rate_R += (radius[i].A * cos_a - radius[i].B * sin_a) * da;
+	}
+
+	/* radians and AU per day */
+	dL = ln_deg_to_rad(144.96 + rate_L * 0.000001) / 36525.0;
+	dB = ln_deg_to_rad(rate_B * 0.000001) / 36525.0;
+	dR = rate_R * 0.0000001 / 36525.0;
+
+	sin_L = sin(ln_deg_to_rad(h_pluto.L));
+	cos_L = cos(ln_deg_to_rad(h_pluto.L));
+	sin_B = sin(ln_deg_to_rad(h_pluto.B));
+	cos_B = cos(ln_deg_to_rad(h_pluto.B));
+
+	/* ecliptic then equatorial as ln_get_rect_from_helio() */
+	x = dR * cos_B * cos_L - h_pluto.R * (dL * cos_B * sin_L +
+		dB * sin_B * cos_L);
+	y = dR * cos_B * sin_L + h_pluto.R * (dL * cos_B * cos_L -
+		dB * sin_B * sin_L);
+	z = dR * sin_B + h_pluto.R * dB * cos_B;
 
-	/* back to hours, degrees */
-	position->ra = ln_range_degrees(ln_rad_to_deg(ra));
-	position->dec = ln_rad_to_deg(dec);
+	velocity->X = x;
+	velocity->Y = y * 0.917482062 - z * 0.397777156;
+	velocity->Z = y * 0.397777156 + z * 0.917482062;
+}
+
+/*! \fn void ln_get_pluto_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position);
+* \param ctx Epoch context
+* \param position Pointer to store position
+*
+* Calculates Pluto equatorial position for the epoch of ctx, as
+* ln_get_pluto_equ_coords(). The solar position is taken from ctx.
+*/
+void ln_get_pluto_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position)
+{
+	light_time_equ_coords(ctx, pluto_get_rect_posvel, position);
 }
 	
 	
@@ -297,13 +340,8 @@ void ln_get_pluto_helio_coords(double JD, struct ln_helio_posn *position)
 	int i;
 		
 	/* check cache first */
-	if(JD == cJD) {
-		/* cache hit */
-		position->L = cL;
-		position->B = cB;
-		position->R = cR;
+	if (!helio_cache_get(&cache, JD, position))
 		return;
-	}
 	
 	/* get julian centuries since J2000 */
 	t =(JD - 2451545.0) / 36525.0;
@@ -335,10 +373,48 @@ void ln_get_pluto_helio_coords(double JD, struct ln_helio_posn *position)
 	position->R = 40.7241346 + sum_radius * 0.0000001; 
 	
 	/* save cache */
-	cJD = JD;
-	cL = position->L;
-	cB = position->B;
-	cR = position->R;
+	helio_cache_put(&cache, JD, position);
+}
+
+/*! \fn void ln_get_pluto_helio_coords_batch(const double *JD, size_t n, struct ln_helio_posn *position)
+* \param JD Array of n Julian Days
+* \param n Number of Julian Days
+* \param position Array of n heliocentric positions
+*
+* Calculate Pluto's heliocentric coordinates for many julian days. Pluto
+* has only 43 periodic terms so this simply calls
+* ln_get_pluto_helio_coords() for each day.
+*
+* Note: This function is not valid outside the period of 1885-2099. 
+*/
+void ln_get_pluto_helio_coords_batch(const double *JD, size_t n,
+	struct ln_helio_posn *position)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		ln_get_pluto_helio_coords(JD[i], &position[i]);
+}
+
+/*! \fn void ln_get_pluto_helio_coords_sweep(double JD, double step, size_t n, struct ln_helio_posn *position)
+* \param JD Julian Day of the first position
+* \param step Days between positions
+* \param n Number of positions
+* \param position Array of n heliocentric positions
+*
+* Calculate Pluto's heliocentric coordinates for JD, JD + step ...
+* JD + (n - 1) step. Pluto has only 43 periodic terms so this simply calls
+* ln_get_pluto_helio_coords() for each day.
+*
+* Note: This function is not valid outside the period of 1885-2099. 
+*/
+void ln_get_pluto_helio_coords_sweep(double JD, double step, size_t n,
+	struct ln_helio_posn *position)
+{
+	size_t i;
+
+	for (i = 0; i < n; i++)
+		ln_get_pluto_helio_coords(JD + i * step, &position[i]);
 }
 
 /*! \fn double ln_get_pluto_earth_dist(double JD);
@@ -20,6 +20,7 @@
 #include <libnova/sidereal_time.h>
 #include <libnova/nutation.h>
 #include <libnova/utility.h>
+#include <libnova/context.h>
 
 /*! \fn double ln_get_mean_sidereal_time(double JD)
 * \param JD Julian Day
@@ -61,21 +62,59 @@ double ln_get_mean_sidereal_time(double JD)
 */
 
 double ln_get_apparent_sidereal_time(double JD)
+{
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	return ln_get_apparent_sidereal_time_ctx(&ctx);
+}
+
+/*! \fn double ln_get_mean_sidereal_time_ctx(struct ln_ctx *ctx)
+* \param ctx Epoch context
+* \return Mean sidereal time (hours).
+*
+* Calculate the mean sidereal time at the meridian of Greenwich for the
+* epoch of ctx. The result is kept in ctx for later calls.
+*/
+double ln_get_mean_sidereal_time_ctx(struct ln_ctx *ctx)
+{
+	if (!(ctx->valid & LN_CTX_MEAN_SIDEREAL)) {
+		ctx->mean_sidereal = ln_get_mean_sidereal_time(ctx->JD);
+		ctx->valid |= LN_CTX_MEAN_SIDEREAL;
+	}
+
+	return ctx->mean_sidereal;
+}
+
+/*! \fn double ln_get_apparent_sidereal_time_ctx(struct ln_ctx *ctx)
+* \param ctx Epoch context
+* \return Apparent sidereal time (hours).
+*
+* Calculate the apparent sidereal time at the meridian of Greenwich for the
+* epoch of ctx, corrected for nutation. The result is kept in ctx for later
+* calls.
+*/
+double ln_get_apparent_sidereal_time_ctx(struct ln_ctx *ctx)
 {
 	double correction, sidereal;
 	struct ln_nutation nutation;
 
+	if (ctx->valid & LN_CTX_APP_SIDEREAL)
+		return ctx->apparent_sidereal;
+
 	/* get the mean sidereal time */
-	sidereal = ln_get_mean_sidereal_time(JD);
+	sidereal = ln_get_mean_sidereal_time_ctx(ctx);
 
 	/* add corrections for nutation in longitude and for the true obliquity of
 	the ecliptic */
-	ln_get_nutation(JD, &nutation);
+	ln_get_nutation_ctx(ctx, &nutation);
 
 	correction = (nutation.longitude / 15.0 *
 	cos(ln_deg_to_rad(nutation.obliquity)));
 
 	sidereal += correction;
 
+	ctx->apparent_sidereal = sidereal;
+	ctx->valid |= LN_CTX_APP_SIDEREAL;
 	return sidereal;
 }
@@ -24,6 +24,7 @@
 #include <libnova/transform.h>
 #include <libnova/rise_set.h>
 #include <libnova/utility.h>
+#include <libnova/context.h>
 
 /*! \fn void ln_get_solar_geom_coords(double JD, struct ln_helio_posn *position)
 * \param JD Julian day
@@ -46,6 +47,28 @@ void ln_get_solar_geom_coords(double JD, struct ln_helio_posn *position)
 	position->B *= -1.0;
 }
 
+/*! \fn void ln_get_solar_geom_coords_ctx(struct ln_ctx *ctx, struct ln_helio_posn *position)
+* \param ctx Epoch context
+* \param position Pointer to store calculated solar position.
+*
+* Calculate solar geometric coordinates for the epoch of ctx, as
+* ln_get_solar_geom_coords(). The result is kept in ctx for later calls.
+*/
+void ln_get_solar_geom_coords_ctx(struct ln_ctx *ctx,
+	struct ln_helio_posn *position)
+{
+	if (!(ctx->valid & LN_CTX_SUN)) {
+		ln_get_earth_helio_coords_ctx(ctx, &ctx->sun);
+
+		ctx->sun.L += 180.0;
+		ctx->sun.L = ln_range_degrees(ctx->sun.L);
+		ctx->sun.B *= -1.0;
+		ctx->valid |= LN_CTX_SUN;
+	}
+
+	*position = ctx->sun;
+}
+
 /*! \fn void ln_get_solar_equ_coords(double JD, struct ln_equ_posn *position)
 * \param JD Julian day
 * \param position Pointer to store calculated solar position.
@@ -55,26 +78,34 @@ void ln_get_solar_geom_coords(double JD, struct ln_helio_posn *position)
 */
 void ln_get_solar_equ_coords(double JD, struct ln_equ_posn *position)
 {
-	struct ln_helio_posn sol;
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	ln_get_solar_equ_coords_ctx(&ctx, position);
+}
+
+/*! \fn void ln_get_solar_equ_coords_ctx(struct ln_ctx *ctx, struct ln_equ_posn *position)
+* \param ctx Epoch context
+* \param position Pointer to store calculated solar position.
+*
+* Calculate apparent equatorial solar coordinates for the epoch of ctx, as
+* ln_get_solar_equ_coords(). The result is kept in ctx for later calls.
+*/
+void ln_get_solar_equ_coords_ctx(struct ln_ctx *ctx,
+	struct ln_equ_posn *position)
+{
 	struct ln_lnlat_posn LB;
-	struct ln_nutation nutation;
-	double aberration;
-	
-	/* get geometric coords */
-	ln_get_solar_geom_coords(JD, &sol);
-	
-	/* add nutation */
-	ln_get_nutation(JD, &nutation);
-	sol.L += nutation.longitude;
 
-	/* aberration */
-	aberration = (20.4898 / (360.0 * 60.0 * 60.0)) / sol.R;
-	sol.L -= aberration;
-	
-	/* transform to equatorial */
-	LB.lat = sol.B;
-	LB.lng = sol.L;
-	ln_get_equ_from_ecl(&LB, JD, position);
+	if (!(ctx->valid & LN_CTX_SUN_EQU)) {
+		/* apparent coords, with nutation and aberration */
+		ln_get_solar_ecl_coords_ctx(ctx, &LB);
+
+		/* transform to equatorial */
+		ln_get_equ_from_ecl_ctx(ctx, &LB, &ctx->sun_equ);
+		ctx->valid |= LN_CTX_SUN_EQU;
+	}
+
+	*position = ctx->sun_equ;
 }
 
 /*! \fn void ln_get_solar_ecl_coords(double JD, struct ln_lnlat_posn *position)
@@ -85,16 +116,32 @@ void ln_get_solar_equ_coords(double JD, struct ln_equ_posn *position)
 * This function includes the effects of aberration and nutation. 
 */
 void ln_get_solar_ecl_coords(double JD, struct ln_lnlat_posn *position)
+{
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	ln_get_solar_ecl_coords_ctx(&ctx, position);
+}
+
+/*! \fn void ln_get_solar_ecl_coords_ctx(struct ln_ctx *ctx, struct ln_lnlat_posn *position)
+* \param ctx Epoch context
+* \param position Pointer to store calculated solar position.
+*
+* Calculate apparent ecliptical solar coordinates for the epoch of ctx, as
+* ln_get_solar_ecl_coords().
+*/
+void ln_get_solar_ecl_coords_ctx(struct ln_ctx *ctx,
+	struct ln_lnlat_posn *position)
 {
 	struct ln_helio_posn sol;
 	struct ln_nutation nutation;
 	double aberration;
 	
 	/* get geometric coords */
-	ln_get_solar_geom_coords(JD, &sol);
+	ln_get_solar_geom_coords_ctx(ctx, &sol);
 	
 	/* add nutation */
-	ln_get_nutation(JD, &nutation);
+	ln_get_nutation_ctx(ctx, &nutation);
 	sol.L += nutation.longitude;
 
 	/* aberration */
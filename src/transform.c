@@ -22,6 +22,7 @@
 #include <libnova/sidereal_time.h>
 #include <libnova/nutation.h>
 #include <libnova/precession.h>
+#include <libnova/context.h>
 
 /*! \fn void ln_get_rect_from_helio(struct ln_helio_posn *object, struct ln_rect_posn *position); 
 * \param object Object heliocentric coordinates
@@ -82,6 +83,23 @@ void ln_get_hrz_from_equ(const struct ln_equ_posn *object,
 	ln_get_hrz_from_equ_sidereal_time (object, observer, sidereal, position);
 }
 
+/*! \fn void ln_get_hrz_from_equ_ctx(struct ln_ctx *ctx, struct ln_equ_posn *object, struct ln_lnlat_posn *observer, struct ln_hrz_posn *position)
+* \param ctx Epoch context
+* \param object Object coordinates.
+* \param observer Observer cordinates.
+* \param position Pointer to store new position.
+*
+* Transform an objects equatorial coordinates into horizontal coordinates
+* for the epoch of ctx, as ln_get_hrz_from_equ().
+*/
+void ln_get_hrz_from_equ_ctx(struct ln_ctx *ctx,
+	const struct ln_equ_posn *object, const struct ln_lnlat_posn *observer,
+	struct ln_hrz_posn *position)
+{
+	ln_get_hrz_from_equ_sidereal_time(object, observer,
+		ln_get_mean_sidereal_time_ctx(ctx), position);
+}
+
 
 void ln_get_hrz_from_equ_sidereal_time(const struct ln_equ_posn *object,
 	const struct ln_lnlat_posn *observer, double sidereal,
@@ -197,12 +215,29 @@ void ln_get_equ_from_hrz(const struct ln_hrz_posn *object,
 */
 void ln_get_equ_from_ecl(const struct ln_lnlat_posn *object, double JD,
 	struct ln_equ_posn *position)
+{
+	struct ln_ctx ctx;
+
+	ln_ctx_init(&ctx, JD);
+	ln_get_equ_from_ecl_ctx(&ctx, object, position);
+}
+
+/*! \fn void ln_get_equ_from_ecl_ctx(struct ln_ctx *ctx, struct ln_lnlat_posn *object, struct ln_equ_posn *position)
+* \param ctx Epoch context
+* \param object Object coordinates.
+* \param position Pointer to store new position.
+*
+* Transform an objects ecliptical coordinates into equatorial coordinates
+* for the epoch of ctx, as ln_get_equ_from_ecl().
+*/
+void ln_get_equ_from_ecl_ctx(struct ln_ctx *ctx,
+	const struct ln_lnlat_posn *object, struct ln_equ_posn *position)
 {
 	double ra, declination, longitude, latitude;
 	struct ln_nutation nutation;
 
 	/* get obliquity of ecliptic and change it to rads */
-	ln_get_nutation(JD, &nutation);
+	ln_get_nutation_ctx(ctx, &nutation);
 	nutation.ecliptic = ln_deg_to_rad(nutation.ecliptic); 
 
 	/* change object's position into radians */
@@ -0,0 +1,186 @@
+#ifndef	LIBNOVA_VSOP87PRIV_H
+#define	LIBNOVA_VSOP87PRIV_H
+
+#include <stddef.h>
+#include <libnova/vsop87.h>
+
+/* highest power of t used by the VSOP87 series */
+#define VSOP87_POWERS	6
+
+/* truncation levels, 10^0 down to 10^-(VSOP87_LEVELS - 1) */
+#define VSOP87_LEVELS	12
+
+/* A library built with --enable-data-file keeps the series in its data
+ * file and their arrays are filled in by data_load() when a body is first
+ * used, so the descriptors cannot be const. */
+#ifdef LN_DATA_FILE
+#define SERIES_CONST
+#else
+#define SERIES_CONST	const
+#endif
+
+/* double terms are padded to a multiple of this, the widest double kernel */
+#define VSOP87_PAD	8
+
+/* One VSOP87 series, made by mkseries from the tables in vsop87/ when the
+ * library is built. A, B and C are separate arrays padded with zero
+ * amplitude terms to count, a multiple of VSOP87_PAD. The terms are in
+ * order of decreasing amplitude and cutoff[k], also a multiple of
+ * VSOP87_PAD, is the number of leading terms needed for the sum of |A|
+ * over the terms after them to be no more than 10^-k radians or AU. */
+struct vsop87_series
+{
+	const double *A;
+	const double *B;
+	const double *C;
+	int count;
+	int cutoff[VSOP87_LEVELS];
+};
+
+/* a coordinate, series for t^0 .. t^(powers - 1) */
+struct vsop87_coord
+{
+	int powers;
+	struct vsop87_series series[VSOP87_POWERS];
+};
+
+/* heliocentric L, B and R of a planet */
+struct vsop87_planet
+{
+	struct vsop87_coord L;
+	struct vsop87_coord B;
+	struct vsop87_coord R;
+	int body;	/* LN_BODY_ of the planet, for data_load() */
+};
+
+/* series of the planets, in series_tables.c */
+extern SERIES_CONST struct vsop87_planet mercury_vsop87;
+extern SERIES_CONST struct vsop87_planet venus_vsop87;
+extern SERIES_CONST struct vsop87_planet earth_vsop87;
+extern SERIES_CONST struct vsop87_planet mars_vsop87;
+extern SERIES_CONST struct vsop87_planet jupiter_vsop87;
+extern SERIES_CONST struct vsop87_planet saturn_vsop87;
+extern SERIES_CONST struct vsop87_planet uranus_vsop87;
+extern SERIES_CONST struct vsop87_planet neptune_vsop87;
+
+/* a series of the VSOP87 tables in vsop87/, only read by mkseries */
+struct vsop87_table_series
+{
+	const struct ln_vsop *terms;
+	int count;
+};
+
+struct vsop87_table_coord
+{
+	int powers;
+	struct vsop87_table_series series[VSOP87_POWERS];
+};
+
+struct vsop87_table
+{
+	struct vsop87_table_coord L;
+	struct vsop87_table_coord B;
+	struct vsop87_table_coord R;
+};
+
+extern const struct vsop87_table mercury_table;
+extern const struct vsop87_table venus_table;
+extern const struct vsop87_table earth_table;
+extern const struct vsop87_table mars_table;
+extern const struct vsop87_table jupiter_table;
+extern const struct vsop87_table saturn_table;
+extern const struct vsop87_table uranus_table;
+extern const struct vsop87_table neptune_table;
+
+/* float terms are padded to a multiple of this, the widest float kernel */
+#define FLOAT_SERIES_PAD	16
+
+/* A series for the single precision kernels, made by mkseries when the
+ * library is built. The leading terms whose amplitude is too large for a
+ * float argument to be good enough stay in double precision in head_A,
+ * head_B and head_C, a multiple of VSOP87_PAD of them, and the rest are
+ * in float A, B and C arrays padded with zero amplitude terms to a
+ * multiple of FLOAT_SERIES_PAD. */
+struct float_series
+{
+	const double *head_A;
+	const double *head_B;
+	const double *head_C;
+	int heads;
+	const float *A;
+	const float *B;
+	const float *C;
+	int count;
+};
+
+/* a coordinate, float series for t^0 .. t^(powers - 1) */
+struct float_coord
+{
+	int powers;
+	struct float_series series[VSOP87_POWERS];
+};
+
+/* heliocentric L, B and R of a planet in float series */
+struct float_planet
+{
+	struct float_coord L;
+	struct float_coord B;
+	struct float_coord R;
+	int body;	/* LN_BODY_ of the planet, for data_load() */
+};
+
+/* float series of the planets, in series_tables.c */
+extern SERIES_CONST struct float_planet mercury_float;
+extern SERIES_CONST struct float_planet venus_float;
+extern SERIES_CONST struct float_planet earth_float;
+extern SERIES_CONST struct float_planet mars_float;
+extern SERIES_CONST struct float_planet jupiter_float;
+extern SERIES_CONST struct float_planet saturn_float;
+extern SERIES_CONST struct float_planet uranus_float;
+extern SERIES_CONST struct float_planet neptune_float;
+
+/* sum of A * cos(B + C * t) over a float series */
+double float_calc_series(const struct float_series *series, double t);
+
+/* FK5 heliocentric position of a planet for one JD from its float series */
+void vsop87_get_helio_coords_float(const struct float_planet *planet,
+	double JD, struct ln_helio_posn *position);
+
+/* FK5 heliocentric position of a planet for one JD */
+void vsop87_get_helio_coords(const struct vsop87_planet *planet, double JD,
+	struct ln_helio_posn *position);
+
+/* FK5 heliocentric position of a planet for one JD, with the series
+ * truncated to within precision radians in L and B and AU in R */
+void vsop87_get_helio_coords_prec(const struct vsop87_planet *planet,
+	double JD, struct ln_helio_posn *position, double precision);
+
+/* FK5 heliocentric position of a planet for one JD and its rate of change
+ * in degrees and AU per day */
+void vsop87_get_helio_posvel(const struct vsop87_planet *planet, double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity);
+
+/* FK5 heliocentric positions of a planet for n JDs */
+void vsop87_get_helio_coords_batch(const struct vsop87_planet *planet,
+	const double *JD, size_t n, struct ln_helio_posn *position);
+
+/* FK5 heliocentric equatorial rectangular position of a planet for one JD,
+ * as ln_get_rect_from_helio() of its heliocentric position */
+void vsop87_get_rect_helio(const struct vsop87_planet *planet, double JD,
+	struct ln_rect_posn *position);
+
+/* FK5 heliocentric equatorial rectangular position of a planet for one JD
+ * and its velocity in AU per day, and optionally its heliocentric position */
+void vsop87_get_rect_posvel(const struct vsop87_planet *planet, double JD,
+	struct ln_rect_posn *position, struct ln_rect_posn *velocity,
+	struct ln_helio_posn *helio);
+
+/* FK5 heliocentric equatorial rectangular positions of a planet for n JDs */
+void vsop87_get_rect_helio_batch(const struct vsop87_planet *planet,
+	const double *JD, size_t n, struct ln_rect_posn *position);
+
+/* FK5 heliocentric positions of a planet for n JDs step days apart */
+void vsop87_get_helio_coords_sweep(const struct vsop87_planet *planet,
+	double JD, double step, size_t n, struct ln_helio_posn *position);
+
+#endif	/* LIBNOVA_VSOP87PRIV_H */
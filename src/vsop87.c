@@ -21,22 +21,828 @@
 
 
 #include <math.h>
+#include <string.h>
 #include <libnova/vsop87.h>
 #include <libnova/utility.h>
+#include "vsop87-priv.h"
+#include "data-priv.h"
 
-double ln_calc_series(const struct ln_vsop *data, int terms, double t)
+/* epochs evaluated together by the batch functions */
+#define BATCH_EPOCHS	64
+
+/* terms advanced together by the sweep recurrence */
+#define SWEEP_TERMS	256
+
+/* epochs a sweep advances by recurrence before evaluating each term
+ * directly again, limiting the rounding drift to about 1e-14 of the
+ * term amplitude */
+#define SWEEP_RESET	64
+
+/* The AVX2 and AVX-512 series kernels are built with per function target
+ * attributes and selected at load time, so the rest of the library does not
+ * need to be compiled with -mavx2 or -mavx512f. */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+	!defined(__MINGW__)
+#define VSOP87_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+/* generic C series kernel */
+static double calc_series_c(const double *A, const double *B, const double *C,
+	int terms, double t)
 {
 	double value = 0.0;
 	int i;
 
+	for (i = 0; i < terms; i++)
+		value += A[i] * cos(B[i] + C[i] * t);
+
+	return value;
+}
+
+/* generic C batch kernel, adds the series at n times to sum[] */
+static void calc_series_batch_c(const double *A, const double *B,
+	const double *C, int terms, const double *t, int n, double *sum)
+{
+	int i, j;
+
+	for (j = 0; j < terms; j++) {
+		for (i = 0; i < n; i++)
+			sum[i] += A[j] * cos(B[j] + C[j] * t[i]);
+	}
+}
+
+/* generic C kernel for the series and its derivative with respect to t */
+static double calc_series_posvel_c(const double *A, const double *B,
+	const double *C, int terms, double t, double *rate)
+{
+	double value = 0.0, dvalue = 0.0, x;
+	int i;
+
 	for (i = 0; i < terms; i++) {
-		value += data->A * cos(data->B + data->C * t);
-		data++;
+		x = B[i] + C[i] * t;
+		value += A[i] * cos(x);
+		dvalue -= A[i] * C[i] * sin(x);
 	}
-	
+
+	*rate = dvalue;
+	return value;
+}
+
+/* Add the series at t, t + dt ... t + (n - 1) dt to sum[], for n no more
+ * than SWEEP_RESET. Each term starts from a direct cos() and sin() of its
+ * argument at t and is rotated by C * dt for each later epoch using
+ * cos(a + b) = cos a cos b - sin a sin b, sin(a + b) = sin a cos b + cos a sin b. */
+static void calc_series_sweep_c(const double *A, const double *B,
+	const double *C, int terms, double t, double dt, int n, double *sum)
+{
+	double amp[SWEEP_TERMS], c[SWEEP_TERMS], s[SWEEP_TERMS];
+	double cd[SWEEP_TERMS], sd[SWEEP_TERMS];
+	double a0, a1, a2, a3, x, cn;
+	int first, m, i, k;
+
+	for (first = 0; first < terms; first += SWEEP_TERMS) {
+		m = terms - first < SWEEP_TERMS ? terms - first : SWEEP_TERMS;
+
+		for (i = 0; i < m; i++) {
+			amp[i] = A[first + i];
+			x = B[first + i] + C[first + i] * t;
+			c[i] = cos(x);
+			s[i] = sin(x);
+			x = C[first + i] * dt;
+			cd[i] = cos(x);
+			sd[i] = sin(x);
+		}
+
+		/* pad to a multiple of 4 with zero amplitude terms */
+		for (; m % 4; m++)
+			amp[m] = c[m] = s[m] = cd[m] = sd[m] = 0.0;
+
+		for (k = 0; k < n; k++) {
+			a0 = a1 = a2 = a3 = 0.0;
+			for (i = 0; i < m; i += 4) {
+				a0 += amp[i] * c[i];
+				a1 += amp[i + 1] * c[i + 1];
+				a2 += amp[i + 2] * c[i + 2];
+				a3 += amp[i + 3] * c[i + 3];
+			}
+			sum[k] += (a0 + a1) + (a2 + a3);
+
+			if (k == n - 1)
+				break;
+
+			for (i = 0; i < m; i++) {
+				cn = c[i] * cd[i] - s[i] * sd[i];
+				s[i] = s[i] * cd[i] + c[i] * sd[i];
+				c[i] = cn;
+			}
+		}
+	}
+}
+
+/* generic C float kernel */
+static double calc_float_series_c(const float *A, const float *B,
+	const float *C, int count, float t)
+{
+	float value = 0.0f;
+	int i;
+
+	for (i = 0; i < count; i++)
+		value += A[i] * cosf(B[i] + C[i] * t);
+
+	return value;
+}
+
+#ifdef VSOP87_X86_KERNELS
+
+/* Cody-Waite split of PI / 2 and the minimax polynomial coefficients of
+ * sin() and cos() over [-PI/4, PI/4] from FDLIBM. */
+#define PIO2_1		1.57079632673412561417e+00
+#define PIO2_2		6.07710050630396597660e-11
+#define PIO2_3		2.02226624871116645580e-21
+#define INV_PIO2	6.36619772367581382433e-01
+#define S1	-1.66666666666666324348e-01
+#define S2	8.33333333332248946124e-03
+#define S3	-1.98412698298579493134e-04
+#define S4	2.75573137070700676789e-06
+#define S5	-2.50507602534068634195e-08
+#define S6	1.58969099521155010221e-10
+#define C1	4.16666666666666019037e-02
+#define C2	-1.38888888888741095749e-03
+#define C3	2.48015872894767294178e-05
+#define C4	-2.75573143513906633035e-07
+#define C5	2.08757232129817482790e-09
+#define C6	-1.13596475577881948265e-11
+
+/* adding 1.5 * 2^52 leaves the integer part in the low mantissa bits */
+#define ROUND_MAGIC	6755399441055744.0
+
+/* beyond this the three part reduction loses accuracy, use libm instead */
+#define MAX_ARG		1.0e9
+
+/* PI/2 in 3 floats and the cephes sinf() and cosf() coefficients for
+ * |r| < PI/4, for the float kernels */
+#define PIO2F_1		1.5703125f
+#define PIO2F_2		4.837512969970703125e-4f
+#define PIO2F_3		7.54978995489188216e-8f
+#define INV_PIO2F	6.36619772e-01f
+#define SF1	-1.6666654611e-1f
+#define SF2	8.3321608736e-3f
+#define SF3	-1.9515295891e-4f
+#define CF1	4.166664568298827e-2f
+#define CF2	-1.388731625493765e-3f
+#define CF3	2.443315711809948e-5f
+
+/* float arguments over MAX_ARG_F are passed to cosf() */
+#define MAX_ARG_F	1.0e7f
+
+#define AVX2_TARGET	__attribute__((target("avx2,fma")))
+#define AVX512_TARGET	__attribute__((target("avx512f")))
+
+/* cosine and sine of 4 doubles, within 1 ulp of libm for |x| < MAX_ARG */
+static inline __m256d AVX2_TARGET sincos4(__m256d x, __m256d *sin_x)
+{
+	__m256d q, r, z, s, c, hz, w;
+	__m256i n, swap, sign;
+
+	/* reduce x to r = x - q * PI/2, r in [-PI/4, PI/4] */
+	q = _mm256_round_pd(_mm256_mul_pd(x, _mm256_set1_pd(INV_PIO2)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_1), x);
+	r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_2), r);
+	r = _mm256_fnmadd_pd(q, _mm256_set1_pd(PIO2_3), r);
+	n = _mm256_castpd_si256(_mm256_add_pd(q, _mm256_set1_pd(ROUND_MAGIC)));
+
+	z = _mm256_mul_pd(r, r);
+
+	/* sin(r) */
+	s = _mm256_fmadd_pd(z, _mm256_set1_pd(S6), _mm256_set1_pd(S5));
+	s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(S4));
+	s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(S3));
+	s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(S2));
+	s = _mm256_fmadd_pd(z, s, _mm256_set1_pd(S1));
+	s = _mm256_fmadd_pd(_mm256_mul_pd(z, r), s, r);
+
+	/* cos(r) */
+	c = _mm256_fmadd_pd(z, _mm256_set1_pd(C6), _mm256_set1_pd(C5));
+	c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(C4));
+	c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(C3));
+	c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(C2));
+	c = _mm256_fmadd_pd(z, c, _mm256_set1_pd(C1));
+	c = _mm256_mul_pd(_mm256_mul_pd(z, z), c);
+	hz = _mm256_mul_pd(z, _mm256_set1_pd(0.5));
+	w = _mm256_sub_pd(_mm256_set1_pd(1.0), hz);
+	c = _mm256_add_pd(w, _mm256_add_pd(_mm256_sub_pd(
+		_mm256_sub_pd(_mm256_set1_pd(1.0), w), hz), c));
+
+	/* for cos() quadrant 1 and 3 use sin(r) and quadrant 1 and 2 are
+	 * negative, for sin() quadrant 1 and 3 use cos(r) and quadrant 2 and
+	 * 3 are negative */
+	swap = _mm256_cmpeq_epi64(_mm256_and_si256(n, _mm256_set1_epi64x(1)),
+		_mm256_set1_epi64x(1));
+
+	sign = _mm256_slli_epi64(n, 62);
+	*sin_x = _mm256_xor_pd(_mm256_blendv_pd(s, c, _mm256_castsi256_pd(swap)),
+		_mm256_and_pd(_mm256_castsi256_pd(sign), _mm256_set1_pd(-0.0)));
+
+	sign = _mm256_slli_epi64(_mm256_add_epi64(n, _mm256_set1_epi64x(1)), 62);
+	c = _mm256_blendv_pd(c, s, _mm256_castsi256_pd(swap));
+	return _mm256_xor_pd(c, _mm256_and_pd(_mm256_castsi256_pd(sign),
+		_mm256_set1_pd(-0.0)));
+}
+
+/* cosine of 4 doubles, the unused sine is dropped when inlined */
+static inline __m256d AVX2_TARGET cos4(__m256d x)
+{
+	__m256d s;
+
+	return sincos4(x, &s);
+}
+
+/* AVX2 series kernel, 4 terms per iteration */
+static double AVX2_TARGET calc_series_avx2(const double *A, const double *B,
+	const double *C, int terms, double t)
+{
+	__m256d sum = _mm256_setzero_pd(), vt = _mm256_set1_pd(t), x;
+	double lane[4], value = 0.0;
+	int i, j;
+
+	for (i = 0; i + 4 <= terms; i += 4) {
+		x = _mm256_fmadd_pd(_mm256_loadu_pd(C + i), vt,
+			_mm256_loadu_pd(B + i));
+
+		if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(
+			_mm256_set1_pd(-0.0), x), _mm256_set1_pd(MAX_ARG),
+			_CMP_GT_OQ))) {
+			value += calc_series_c(A + i, B + i, C + i, 4, t);
+			continue;
+		}
+
+		sum = _mm256_fmadd_pd(_mm256_loadu_pd(A + i), cos4(x), sum);
+	}
+
+	_mm256_storeu_pd(lane, sum);
+	for (j = 0; j < 4; j++)
+		value += lane[j];
+
+	return value + calc_series_c(A + i, B + i, C + i, terms - i, t);
+}
+
+/* cosine of 8 floats, to a few float ulp for |x| < MAX_ARG_F */
+static inline __m256 AVX2_TARGET cos8f(__m256 x)
+{
+	__m256 q, r, z, s, c;
+	__m256i n, swap, sign;
+
+	/* reduce x to r = x - q * PI/2, r in [-PI/4, PI/4] */
+	q = _mm256_round_ps(_mm256_mul_ps(x, _mm256_set1_ps(INV_PIO2F)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	r = _mm256_fnmadd_ps(q, _mm256_set1_ps(PIO2F_1), x);
+	r = _mm256_fnmadd_ps(q, _mm256_set1_ps(PIO2F_2), r);
+	r = _mm256_fnmadd_ps(q, _mm256_set1_ps(PIO2F_3), r);
+	n = _mm256_cvtps_epi32(q);
+
+	z = _mm256_mul_ps(r, r);
+
+	/* sin(r) */
+	s = _mm256_fmadd_ps(z, _mm256_set1_ps(SF3), _mm256_set1_ps(SF2));
+	s = _mm256_fmadd_ps(z, s, _mm256_set1_ps(SF1));
+	s = _mm256_fmadd_ps(_mm256_mul_ps(z, r), s, r);
+
+	/* cos(r) */
+	c = _mm256_fmadd_ps(z, _mm256_set1_ps(CF3), _mm256_set1_ps(CF2));
+	c = _mm256_fmadd_ps(z, c, _mm256_set1_ps(CF1));
+	c = _mm256_fmadd_ps(_mm256_mul_ps(z, z), c, _mm256_fnmadd_ps(
+		_mm256_set1_ps(0.5f), z, _mm256_set1_ps(1.0f)));
+
+	/* quadrant 1 and 3 use sin(r) and quadrant 1 and 2 are negative */
+	swap = _mm256_cmpeq_epi32(_mm256_and_si256(n, _mm256_set1_epi32(1)),
+		_mm256_set1_epi32(1));
+	sign = _mm256_slli_epi32(_mm256_add_epi32(n, _mm256_set1_epi32(1)), 30);
+	c = _mm256_blendv_ps(c, s, _mm256_castsi256_ps(swap));
+	return _mm256_xor_ps(c, _mm256_and_ps(_mm256_castsi256_ps(sign),
+		_mm256_set1_ps(-0.0f)));
+}
+
+/* AVX2 float kernel, 8 terms per iteration. count is a multiple of
+ * FLOAT_SERIES_PAD. */
+static double AVX2_TARGET calc_float_series_avx2(const float *A,
+	const float *B, const float *C, int count, float t)
+{
+	__m256 sum = _mm256_setzero_ps(), vt = _mm256_set1_ps(t), x;
+	float lane[8];
+	double value = 0.0;
+	int i, j;
+
+	for (i = 0; i < count; i += 8) {
+		x = _mm256_fmadd_ps(_mm256_loadu_ps(C + i), vt,
+			_mm256_loadu_ps(B + i));
+
+		if (_mm256_movemask_ps(_mm256_cmp_ps(_mm256_andnot_ps(
+			_mm256_set1_ps(-0.0f), x), _mm256_set1_ps(MAX_ARG_F),
+			_CMP_GT_OQ))) {
+			value += calc_float_series_c(A + i, B + i, C + i, 8, t);
+			continue;
+		}
+
+		sum = _mm256_fmadd_ps(_mm256_loadu_ps(A + i), cos8f(x), sum);
+	}
+
+	_mm256_storeu_ps(lane, sum);
+	for (j = 0; j < 8; j++)
+		value += lane[j];
+
+	return value;
+}
+
+/* AVX2 batch kernel, each term is applied to 4 times per iteration */
+static void AVX2_TARGET calc_series_batch_avx2(const double *A,
+	const double *B, const double *C, int terms, const double *t, int n,
+	double *sum)
+{
+	__m256d a, b, c, x;
+	int i, j;
+
+	for (j = 0; j < terms; j++) {
+		a = _mm256_set1_pd(A[j]);
+		b = _mm256_set1_pd(B[j]);
+		c = _mm256_set1_pd(C[j]);
+
+		for (i = 0; i + 4 <= n; i += 4) {
+			x = _mm256_fmadd_pd(c, _mm256_loadu_pd(t + i), b);
+
+			if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(
+				_mm256_set1_pd(-0.0), x), _mm256_set1_pd(MAX_ARG),
+				_CMP_GT_OQ))) {
+				calc_series_batch_c(A + j, B + j, C + j, 1, t + i, 4,
+					sum + i);
+				continue;
+			}
+
+			_mm256_storeu_pd(sum + i, _mm256_fmadd_pd(a, cos4(x),
+				_mm256_loadu_pd(sum + i)));
+		}
+
+		calc_series_batch_c(A + j, B + j, C + j, 1, t + i, n - i, sum + i);
+	}
+}
+
+/* AVX2 series and derivative kernel, 4 terms per iteration */
+static double AVX2_TARGET calc_series_posvel_avx2(const double *A,
+	const double *B, const double *C, int terms, double t, double *rate)
+{
+	__m256d sum = _mm256_setzero_pd(), dsum = _mm256_setzero_pd();
+	__m256d vt = _mm256_set1_pd(t);
+	__m256d a, c, x, cos_x, sin_x;
+	double lane[4], dlane[4], value = 0.0, dvalue = 0.0, r;
+	int i, j;
+
+	for (i = 0; i + 4 <= terms; i += 4) {
+		c = _mm256_loadu_pd(C + i);
+		x = _mm256_fmadd_pd(c, vt, _mm256_loadu_pd(B + i));
+
+		if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(
+			_mm256_set1_pd(-0.0), x), _mm256_set1_pd(MAX_ARG),
+			_CMP_GT_OQ))) {
+			value += calc_series_posvel_c(A + i, B + i, C + i, 4, t, &r);
+			dvalue += r;
+			continue;
+		}
+
+		a = _mm256_loadu_pd(A + i);
+		cos_x = sincos4(x, &sin_x);
+		sum = _mm256_fmadd_pd(a, cos_x, sum);
+		dsum = _mm256_fnmadd_pd(_mm256_mul_pd(a, c), sin_x, dsum);
+	}
+
+	_mm256_storeu_pd(lane, sum);
+	_mm256_storeu_pd(dlane, dsum);
+	for (j = 0; j < 4; j++) {
+		value += lane[j];
+		dvalue += dlane[j];
+	}
+
+	value += calc_series_posvel_c(A + i, B + i, C + i, terms - i, t, &r);
+	*rate = dvalue + r;
+	return value;
+}
+
+/* cosine and sine of 8 doubles, same method as sincos4() */
+static inline __m512d AVX512_TARGET sincos8(__m512d x, __m512d *sin_x)
+{
+	__m512d q, r, z, s, c, hz, w;
+	__m512i n;
+	__mmask8 swap, sign;
+
+	q = _mm512_roundscale_pd(_mm512_mul_pd(x, _mm512_set1_pd(INV_PIO2)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	r = _mm512_fnmadd_pd(q, _mm512_set1_pd(PIO2_1), x);
+	r = _mm512_fnmadd_pd(q, _mm512_set1_pd(PIO2_2), r);
+	r = _mm512_fnmadd_pd(q, _mm512_set1_pd(PIO2_3), r);
+	n = _mm512_castpd_si512(_mm512_add_pd(q, _mm512_set1_pd(ROUND_MAGIC)));
+
+	z = _mm512_mul_pd(r, r);
+
+	s = _mm512_fmadd_pd(z, _mm512_set1_pd(S6), _mm512_set1_pd(S5));
+	s = _mm512_fmadd_pd(z, s, _mm512_set1_pd(S4));
+	s = _mm512_fmadd_pd(z, s, _mm512_set1_pd(S3));
+	s = _mm512_fmadd_pd(z, s, _mm512_set1_pd(S2));
+	s = _mm512_fmadd_pd(z, s, _mm512_set1_pd(S1));
+	s = _mm512_fmadd_pd(_mm512_mul_pd(z, r), s, r);
+
+	c = _mm512_fmadd_pd(z, _mm512_set1_pd(C6), _mm512_set1_pd(C5));
+	c = _mm512_fmadd_pd(z, c, _mm512_set1_pd(C4));
+	c = _mm512_fmadd_pd(z, c, _mm512_set1_pd(C3));
+	c = _mm512_fmadd_pd(z, c, _mm512_set1_pd(C2));
+	c = _mm512_fmadd_pd(z, c, _mm512_set1_pd(C1));
+	c = _mm512_mul_pd(_mm512_mul_pd(z, z), c);
+	hz = _mm512_mul_pd(z, _mm512_set1_pd(0.5));
+	w = _mm512_sub_pd(_mm512_set1_pd(1.0), hz);
+	c = _mm512_add_pd(w, _mm512_add_pd(_mm512_sub_pd(
+		_mm512_sub_pd(_mm512_set1_pd(1.0), w), hz), c));
+
+	swap = _mm512_test_epi64_mask(n, _mm512_set1_epi64(1));
+
+	sign = _mm512_test_epi64_mask(n, _mm512_set1_epi64(2));
+	*sin_x = _mm512_mask_blend_pd(swap, s, c);
+	*sin_x = _mm512_mask_sub_pd(*sin_x, sign, _mm512_setzero_pd(), *sin_x);
+
+	sign = _mm512_test_epi64_mask(_mm512_add_epi64(n, _mm512_set1_epi64(1)),
+		_mm512_set1_epi64(2));
+	c = _mm512_mask_blend_pd(swap, c, s);
+	return _mm512_mask_sub_pd(c, sign, _mm512_setzero_pd(), c);
+}
+
+/* cosine of 8 doubles, the unused sine is dropped when inlined */
+static inline __m512d AVX512_TARGET cos8(__m512d x)
+{
+	__m512d s;
+
+	return sincos8(x, &s);
+}
+
+/* AVX-512 series kernel, 8 terms per iteration */
+static double AVX512_TARGET calc_series_avx512(const double *A,
+	const double *B, const double *C, int terms, double t)
+{
+	__m512d sum = _mm512_setzero_pd(), vt = _mm512_set1_pd(t), x;
+	double value = 0.0;
+	int i;
+
+	for (i = 0; i + 8 <= terms; i += 8) {
+		x = _mm512_fmadd_pd(_mm512_loadu_pd(C + i), vt,
+			_mm512_loadu_pd(B + i));
+
+		if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(MAX_ARG),
+			_CMP_GT_OQ)) {
+			value += calc_series_c(A + i, B + i, C + i, 8, t);
+			continue;
+		}
+
+		sum = _mm512_fmadd_pd(_mm512_loadu_pd(A + i), cos8(x), sum);
+	}
+
+	value += _mm512_reduce_add_pd(sum);
+	return value + calc_series_c(A + i, B + i, C + i, terms - i, t);
+}
+
+/* cosine of 16 floats, same method as cos8f() */
+static inline __m512 AVX512_TARGET cos16f(__m512 x)
+{
+	__m512 q, r, z, s, c;
+	__m512i n;
+	__mmask16 swap, sign;
+
+	q = _mm512_roundscale_ps(_mm512_mul_ps(x, _mm512_set1_ps(INV_PIO2F)),
+		_MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	r = _mm512_fnmadd_ps(q, _mm512_set1_ps(PIO2F_1), x);
+	r = _mm512_fnmadd_ps(q, _mm512_set1_ps(PIO2F_2), r);
+	r = _mm512_fnmadd_ps(q, _mm512_set1_ps(PIO2F_3), r);
+	n = _mm512_cvtps_epi32(q);
+
+	z = _mm512_mul_ps(r, r);
+
+	s = _mm512_fmadd_ps(z, _mm512_set1_ps(SF3), _mm512_set1_ps(SF2));
+	s = _mm512_fmadd_ps(z, s, _mm512_set1_ps(SF1));
+	s = _mm512_fmadd_ps(_mm512_mul_ps(z, r), s, r);
+
+	c = _mm512_fmadd_ps(z, _mm512_set1_ps(CF3), _mm512_set1_ps(CF2));
+	c = _mm512_fmadd_ps(z, c, _mm512_set1_ps(CF1));
+	c = _mm512_fmadd_ps(_mm512_mul_ps(z, z), c, _mm512_fnmadd_ps(
+		_mm512_set1_ps(0.5f), z, _mm512_set1_ps(1.0f)));
+
+	swap = _mm512_test_epi32_mask(n, _mm512_set1_epi32(1));
+	sign = _mm512_test_epi32_mask(_mm512_add_epi32(n, _mm512_set1_epi32(1)),
+		_mm512_set1_epi32(2));
+	c = _mm512_mask_blend_ps(swap, c, s);
+	return _mm512_mask_sub_ps(c, sign, _mm512_setzero_ps(), c);
+}
+
+/* AVX-512 float kernel, 16 terms per iteration */
+static double AVX512_TARGET calc_float_series_avx512(const float *A,
+	const float *B, const float *C, int count, float t)
+{
+	__m512 sum = _mm512_setzero_ps(), vt = _mm512_set1_ps(t), x;
+	float lane[16];
+	double value = 0.0;
+	int i, j;
+
+	for (i = 0; i < count; i += 16) {
+		x = _mm512_fmadd_ps(_mm512_loadu_ps(C + i), vt,
+			_mm512_loadu_ps(B + i));
+
+		if (_mm512_cmp_ps_mask(_mm512_abs_ps(x),
+			_mm512_set1_ps(MAX_ARG_F), _CMP_GT_OQ)) {
+			value += calc_float_series_c(A + i, B + i, C + i, 16, t);
+			continue;
+		}
+
+		sum = _mm512_fmadd_ps(_mm512_loadu_ps(A + i), cos16f(x), sum);
+	}
+
+	_mm512_storeu_ps(lane, sum);
+	for (j = 0; j < 16; j++)
+		value += lane[j];
+
+	return value;
+}
+
+/* AVX-512 series and derivative kernel, 8 terms per iteration */
+static double AVX512_TARGET calc_series_posvel_avx512(const double *A,
+	const double *B, const double *C, int terms, double t, double *rate)
+{
+	__m512d sum = _mm512_setzero_pd(), dsum = _mm512_setzero_pd();
+	__m512d vt = _mm512_set1_pd(t);
+	__m512d a, c, x, cos_x, sin_x;
+	double value = 0.0, dvalue = 0.0, r;
+	int i;
+
+	for (i = 0; i + 8 <= terms; i += 8) {
+		c = _mm512_loadu_pd(C + i);
+		x = _mm512_fmadd_pd(c, vt, _mm512_loadu_pd(B + i));
+
+		if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(MAX_ARG),
+			_CMP_GT_OQ)) {
+			value += calc_series_posvel_c(A + i, B + i, C + i, 8, t, &r);
+			dvalue += r;
+			continue;
+		}
+
+		a = _mm512_loadu_pd(A + i);
+		cos_x = sincos8(x, &sin_x);
+		sum = _mm512_fmadd_pd(a, cos_x, sum);
+		dsum = _mm512_fnmadd_pd(_mm512_mul_pd(a, c), sin_x, dsum);
+	}
+
+	value += _mm512_reduce_add_pd(sum);
+	dvalue += _mm512_reduce_add_pd(dsum);
+
+	value += calc_series_posvel_c(A + i, B + i, C + i, terms - i, t, &r);
+	*rate = dvalue + r;
+	return value;
+}
+
+/* AVX-512 batch kernel, each term is applied to 8 times per iteration */
+static void AVX512_TARGET calc_series_batch_avx512(const double *A,
+	const double *B, const double *C, int terms, const double *t, int n,
+	double *sum)
+{
+	__m512d a, b, c, x;
+	int i, j;
+
+	for (j = 0; j < terms; j++) {
+		a = _mm512_set1_pd(A[j]);
+		b = _mm512_set1_pd(B[j]);
+		c = _mm512_set1_pd(C[j]);
+
+		for (i = 0; i + 8 <= n; i += 8) {
+			x = _mm512_fmadd_pd(c, _mm512_loadu_pd(t + i), b);
+
+			if (_mm512_cmp_pd_mask(_mm512_abs_pd(x),
+				_mm512_set1_pd(MAX_ARG), _CMP_GT_OQ)) {
+				calc_series_batch_c(A + j, B + j, C + j, 1, t + i, 8,
+					sum + i);
+				continue;
+			}
+
+			_mm512_storeu_pd(sum + i, _mm512_fmadd_pd(a, cos8(x),
+				_mm512_loadu_pd(sum + i)));
+		}
+
+		calc_series_batch_c(A + j, B + j, C + j, 1, t + i, n - i, sum + i);
+	}
+}
+
+/* AVX2 sweep kernel, 4 terms at a time advanced across the n epochs */
+static void AVX2_TARGET calc_series_sweep_avx2(const double *A,
+	const double *B, const double *C, int terms, double t, double dt,
+	int n, double *sum)
+{
+	__m256d acc[SWEEP_RESET], a, c, s, cd, sd, cn, x;
+	double lane[4];
+	int i, k;
+
+	for (k = 0; k < n; k++)
+		acc[k] = _mm256_setzero_pd();
+
+	for (i = 0; i + 4 <= terms; i += 4) {
+		x = _mm256_fmadd_pd(_mm256_loadu_pd(C + i), _mm256_set1_pd(t),
+			_mm256_loadu_pd(B + i));
+
+		if (_mm256_movemask_pd(_mm256_cmp_pd(_mm256_andnot_pd(
+			_mm256_set1_pd(-0.0), x), _mm256_set1_pd(MAX_ARG),
+			_CMP_GT_OQ))) {
+			calc_series_sweep_c(A + i, B + i, C + i, 4, t, dt, n, sum);
+			continue;
+		}
+
+		a = _mm256_loadu_pd(A + i);
+		c = sincos4(x, &s);
+		x = _mm256_mul_pd(_mm256_loadu_pd(C + i), _mm256_set1_pd(dt));
+		cd = sincos4(x, &sd);
+
+		for (k = 0; k < n; k++) {
+			acc[k] = _mm256_fmadd_pd(a, c, acc[k]);
+			cn = _mm256_fmsub_pd(c, cd, _mm256_mul_pd(s, sd));
+			s = _mm256_fmadd_pd(s, cd, _mm256_mul_pd(c, sd));
+			c = cn;
+		}
+	}
+
+	for (k = 0; k < n; k++) {
+		_mm256_storeu_pd(lane, acc[k]);
+		sum[k] += (lane[0] + lane[1]) + (lane[2] + lane[3]);
+	}
+
+	calc_series_sweep_c(A + i, B + i, C + i, terms - i, t, dt, n, sum);
+}
+
+/* AVX-512 sweep kernel, 8 terms at a time advanced across the n epochs */
+static void AVX512_TARGET calc_series_sweep_avx512(const double *A,
+	const double *B, const double *C, int terms, double t, double dt,
+	int n, double *sum)
+{
+	__m512d acc[SWEEP_RESET], a, c, s, cd, sd, cn, x;
+	int i, k;
+
+	for (k = 0; k < n; k++)
+		acc[k] = _mm512_setzero_pd();
+
+	for (i = 0; i + 8 <= terms; i += 8) {
+		x = _mm512_fmadd_pd(_mm512_loadu_pd(C + i), _mm512_set1_pd(t),
+			_mm512_loadu_pd(B + i));
+
+		if (_mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(MAX_ARG),
+			_CMP_GT_OQ)) {
+			calc_series_sweep_c(A + i, B + i, C + i, 8, t, dt, n, sum);
+			continue;
+		}
+
+		a = _mm512_loadu_pd(A + i);
+		c = sincos8(x, &s);
+		x = _mm512_mul_pd(_mm512_loadu_pd(C + i), _mm512_set1_pd(dt));
+		cd = sincos8(x, &sd);
+
+		for (k = 0; k < n; k++) {
+			acc[k] = _mm512_fmadd_pd(a, c, acc[k]);
+			cn = _mm512_fmsub_pd(c, cd, _mm512_mul_pd(s, sd));
+			s = _mm512_fmadd_pd(s, cd, _mm512_mul_pd(c, sd));
+			c = cn;
+		}
+	}
+
+	for (k = 0; k < n; k++)
+		sum[k] += _mm512_reduce_add_pd(acc[k]);
+
+	calc_series_sweep_c(A + i, B + i, C + i, terms - i, t, dt, n, sum);
+}
+
+#endif /* VSOP87_X86_KERNELS */
+
+/* series kernels in use, picked for this CPU when the library is loaded */
+static double (*calc_series)(const double *A, const double *B,
+	const double *C, int terms, double t) = calc_series_c;
+static void (*calc_series_batch)(const double *A, const double *B,
+	const double *C, int terms, const double *t, int n,
+	double *sum) = calc_series_batch_c;
+static void (*calc_series_sweep)(const double *A, const double *B,
+	const double *C, int terms, double t, double dt, int n,
+	double *sum) = calc_series_sweep_c;
+static double (*calc_series_posvel)(const double *A, const double *B,
+	const double *C, int terms, double t,
+	double *rate) = calc_series_posvel_c;
+static double (*calc_float_series)(const float *A, const float *B,
+	const float *C, int count, float t) = calc_float_series_c;
+
+#ifdef VSOP87_X86_KERNELS
+static void __attribute__((constructor)) select_series_kernel(void)
+{
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("avx512f")) {
+		calc_series = calc_series_avx512;
+		calc_series_batch = calc_series_batch_avx512;
+		calc_series_sweep = calc_series_sweep_avx512;
+		calc_series_posvel = calc_series_posvel_avx512;
+		calc_float_series = calc_float_series_avx512;
+	} else if (__builtin_cpu_supports("avx2") &&
+		__builtin_cpu_supports("fma")) {
+		calc_series = calc_series_avx2;
+		calc_series_batch = calc_series_batch_avx2;
+		calc_series_sweep = calc_series_sweep_avx2;
+		calc_series_posvel = calc_series_posvel_avx2;
+		calc_float_series = calc_float_series_avx2;
+	}
+}
+#endif
+
+/* terms of the public functions are split into A, B and C a block at a
+ * time for the kernels */
+#define SPLIT_TERMS	256
+
+struct split_terms
+{
+	double A[SPLIT_TERMS];
+	double B[SPLIT_TERMS];
+	double C[SPLIT_TERMS];
+};
+
+/* split up to SPLIT_TERMS terms of data, returns the number split */
+static int split_terms(const struct ln_vsop *data, int terms,
+	struct split_terms *split)
+{
+	int i;
+
+	if (terms > SPLIT_TERMS)
+		terms = SPLIT_TERMS;
+
+	for (i = 0; i < terms; i++) {
+		split->A[i] = data[i].A;
+		split->B[i] = data[i].B;
+		split->C[i] = data[i].C;
+	}
+
+	return terms;
+}
+
+/*! \fn double ln_calc_series(const struct ln_vsop *data, int terms, double t)
+* \param data VSOP87 series coefficients
+* \param terms Number of terms in the series
+* \param t Julian millennia from J2000
+* \return Sum of the series
+*
+* Calculate the sum of A * cos(B + C * t) over a VSOP87 series. On x86
+* CPUs with AVX2 or AVX-512 several terms are evaluated at once with a
+* vectorised cosine, otherwise the terms are summed one at a time.
+*/
+double ln_calc_series(const struct ln_vsop *data, int terms, double t)
+{
+	struct split_terms split;
+	double value = 0.0;
+	int i, block;
+
+	for (i = 0; i < terms; i += block) {
+		block = split_terms(data + i, terms - i, &split);
+		value += calc_series(split.A, split.B, split.C, block, t);
+	}
+
 	return value;
 }
 
+/*! \fn void ln_calc_series_sweep(const struct ln_vsop *data, int terms, double t, double dt, size_t n, double *values)
+* \param data VSOP87 series coefficients
+* \param terms Number of terms in the series
+* \param t Julian millennia from J2000 of the first value
+* \param dt Julian millennia between values
+* \param n Number of values
+* \param values Array to store n sums of the series
+*
+* Calculate the sum of a VSOP87 series at t, t + dt ... t + (n - 1) dt.
+* Rather than a cos() for every term at every time, each term is advanced
+* from one time to the next by the angle addition formulae and evaluated
+* directly again every 64 times so rounding errors do not build up.
+* Results agree with ln_calc_series() to about 1e-14 of the largest
+* amplitude in the series.
+*/
+void ln_calc_series_sweep(const struct ln_vsop *data, int terms, double t,
+	double dt, size_t n, double *values)
+{
+	struct split_terms split;
+	size_t done;
+	int i, block, epochs;
+
+	memset(values, 0, n * sizeof(double));
+
+	for (i = 0; i < terms; i += block) {
+		block = split_terms(data + i, terms - i, &split);
+
+		for (done = 0; done < n; done += epochs) {
+			epochs = n - done < SWEEP_RESET ? n - done : SWEEP_RESET;
+			calc_series_sweep(split.A, split.B, split.C, block,
+				t + done * dt, dt, epochs, values + done);
+		}
+	}
+}
 
 /*! \fn void ln_vsop87_to_fk5(struct ln_helio_posn *position, double JD)
 * \param position Position to transform. 
@@ -66,3 +872,437 @@ void ln_vsop87_to_fk5(struct ln_helio_posn *position, double JD)
 	position->L += delta_L;
 	position->B += delta_B;
 }
+
+/* sum of S0 + S1 * t + S2 * t^2 ... in the order used by Meeus 32.1 */
+static double calc_coord(const double *S, int powers, double t)
+{
+	double value = S[0], tn = t;
+	int i;
+
+	for (i = 1; i < powers; i++) {
+		value += S[i] * tn;
+		tn *= t;
+	}
+
+	return value;
+}
+
+/* radians to FK5 degrees */
+static void finish_helio_coords(struct ln_helio_posn *position, double JD)
+{
+	/* change to degrees in correct quadrant */
+	position->L = ln_rad_to_deg(position->L);
+	position->B = ln_rad_to_deg(position->B);
+	position->L = ln_range_degrees(position->L);
+
+	/* change to fk5 reference frame */
+	ln_vsop87_to_fk5(position, JD);
+}
+
+/* Leading terms of a series to sum for a truncation error of no more
+ * than max, using the first cutoff level at or below max. The bound of
+ * that level is stored in error. */
+static int series_terms(const struct vsop87_series *series, double max,
+	double *error)
+{
+	int level;
+
+	if (max >= 1.0) {
+		*error = 1.0;
+		return series->cutoff[0];
+	}
+
+	level = (int)ceil(-log10(max));
+	if (level >= VSOP87_LEVELS) {
+		*error = 0.0;
+		return series->count;
+	}
+
+	*error = pow(10.0, -level);
+	return series->cutoff[level];
+}
+
+/* rotation vector of equ 31.3, whose L' is L less phi */
+static void fk5_rotation(double JD, double *w)
+{
+	double T, phi, k;
+
+	T = (JD - 2451545.0) / 36525.0;
+	phi = ln_deg_to_rad((1.397 + 0.00031 * T) * T);
+	k = ln_deg_to_rad(0.03916 / 3600.0);
+	w[0] = k * (sin(phi) - cos(phi));
+	w[1] = -k * (sin(phi) + cos(phi));
+	w[2] = ln_deg_to_rad(-0.09033 / 3600.0);
+}
+
+/* VSOP87 ecliptical rectangular r to FK5 equatorial, as r + w x r and then
+ * the J2000 obliquity of ln_get_rect_from_helio() */
+static void rotate_to_equ(const double *w, const double *r,
+	struct ln_rect_posn *position)
+{
+	double x, y, z;
+
+	x = r[0] + w[1] * r[2] - w[2] * r[1];
+	y = r[1] + w[2] * r[0] - w[0] * r[2];
+	z = r[2] + w[0] * r[1] - w[1] * r[0];
+
+	position->X = x;
+	position->Y = y * 0.917482062 - z * 0.397777156;
+	position->Z = y * 0.397777156 + z * 0.917482062;
+}
+
+/* VSOP87 L and B in radians and R to FK5 equatorial rectangular
+ * coordinates. Equ 31.3 is a small rotation of the VSOP87 frame, applied
+ * here as r + w x r so there is no tan(B) or round trip through degrees.
+ * It agrees with ln_vsop87_to_fk5() and ln_get_rect_from_helio() to second
+ * order in the 0.1 arcsec correction, about 1e-13 of the radius vector. */
+static void finish_rect_helio(const double *value, double JD,
+	struct ln_rect_posn *position)
+{
+	double w[3], r[3], cos_B;
+
+	/* ecliptical rectangular in the VSOP87 frame */
+	cos_B = cos(value[1]);
+	r[0] = value[2] * cos_B * cos(value[0]);
+	r[1] = value[2] * cos_B * sin(value[0]);
+	r[2] = value[2] * sin(value[1]);
+
+	fk5_rotation(JD, w);
+	rotate_to_equ(w, r, position);
+}
+
+/* Chapter 31 Pg 206-207 Equ 31.1 31.2 , 31.3 using VSOP 87
+*/
+void vsop87_get_helio_coords(const struct vsop87_planet *planet, double JD,
+	struct ln_helio_posn *position)
+{
+	vsop87_get_helio_coords_prec(planet, JD, position, 0.0);
+}
+
+/* Sum the L, B and R series at t, truncated as vsop87_get_helio_coords_prec()
+ * for precision > 0. The error of a coordinate is no more than the sum over
+ * each series of its dropped |A| times |t|^power. Series are truncated from
+ * the highest power down, each allowed an equal share of the precision not
+ * yet used, so the t^0 series gets whatever the small higher powers leave. */
+static void sum_coords(const struct vsop87_planet *planet, double t,
+	double precision, double *value)
+{
+	const struct vsop87_coord *coord[3] = {&planet->L, &planet->B, &planet->R};
+	const struct vsop87_series *series;
+	double S[VSOP87_POWERS], tn[VSOP87_POWERS], left, error;
+	int i, j, terms;
+
+	data_load(planet->body);
+
+	tn[0] = 1.0;
+	for (j = 1; j < VSOP87_POWERS; j++)
+		tn[j] = tn[j - 1] * fabs(t);
+
+	for (i = 0; i < 3; i++) {
+		left = precision;
+
+		for (j = coord[i]->powers - 1; j >= 0; j--) {
+			series = &coord[i]->series[j];
+			if (precision > 0.0) {
+				terms = series_terms(series,
+					left / ((j + 1) * tn[j]), &error);
+				left -= error * tn[j];
+			} else
+				terms = series->count;
+
+			S[j] = calc_series(series->A, series->B, series->C,
+				terms, t);
+		}
+		value[i] = calc_coord(S, coord[i]->powers, t);
+	}
+}
+
+/* Sum the L, B and R series at epochs times t[] */
+static void sum_coords_batch(const struct vsop87_planet *planet,
+	const double *t, int epochs, double value[3][BATCH_EPOCHS])
+{
+	const struct vsop87_coord *coord[3] = {&planet->L, &planet->B, &planet->R};
+	double S[VSOP87_POWERS][BATCH_EPOCHS], Sn[VSOP87_POWERS];
+	int i, j, k;
+
+	data_load(planet->body);
+
+	for (i = 0; i < 3; i++) {
+		memset(S, 0, sizeof(S));
+		for (j = 0; j < coord[i]->powers; j++)
+			calc_series_batch(coord[i]->series[j].A,
+				coord[i]->series[j].B, coord[i]->series[j].C,
+				coord[i]->series[j].count, t, epochs, S[j]);
+
+		for (k = 0; k < epochs; k++) {
+			for (j = 0; j < coord[i]->powers; j++)
+				Sn[j] = S[j][k];
+			value[i][k] = calc_coord(Sn, coord[i]->powers, t[k]);
+		}
+	}
+}
+
+void vsop87_get_helio_coords_prec(const struct vsop87_planet *planet,
+	double JD, struct ln_helio_posn *position, double precision)
+{
+	double value[3];
+
+	/* get julian ephemeris day */
+	sum_coords(planet, (JD - 2451545.0) / 365250.0, precision, value);
+
+	position->L = value[0];
+	position->B = value[1];
+	position->R = value[2];
+	finish_helio_coords(position, JD);
+}
+
+/* Sum the L, B and R series and their rates per millennium at t in one
+ * pass, each term needing a sine as well as a cosine of its argument. */
+static void sum_coords_posvel(const struct vsop87_planet *planet, double t,
+	double *value, double *rate)
+{
+	const struct vsop87_coord *coord[3] = {&planet->L, &planet->B, &planet->R};
+	double S[VSOP87_POWERS], D[VSOP87_POWERS], tn;
+	int i, j;
+
+	data_load(planet->body);
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < coord[i]->powers; j++)
+			S[j] = calc_series_posvel(coord[i]->series[j].A,
+				coord[i]->series[j].B, coord[i]->series[j].C,
+				coord[i]->series[j].count, t, &D[j]);
+		value[i] = calc_coord(S, coord[i]->powers, t);
+
+		/* d/dt of S0 + S1 * t + S2 * t^2 ... */
+		rate[i] = D[0];
+		tn = 1.0;
+		for (j = 1; j < coord[i]->powers; j++) {
+			rate[i] += (D[j] * t + j * S[j]) * tn;
+			tn *= t;
+		}
+	}
+}
+
+/* The rate of the FK5 correction of equ 31.3 is included too, though it is
+ * below 1e-6 of the rate. */
+void vsop87_get_helio_posvel(const struct vsop87_planet *planet, double JD,
+	struct ln_helio_posn *position, struct ln_helio_posn *velocity)
+{
+	double value[3], rate[3];
+	double T, LL, dLL, cos_LL, sin_LL, B, k;
+
+	/* get julian ephemeris day */
+	sum_coords_posvel(planet, (JD - 2451545.0) / 365250.0, value, rate);
+
+	/* radians and AU per millennium to degrees and AU per day */
+	velocity->L = ln_rad_to_deg(rate[0]) / 365250.0;
+	velocity->B = ln_rad_to_deg(rate[1]) / 365250.0;
+	velocity->R = rate[2] / 365250.0;
+
+	/* rate of the ln_vsop87_to_fk5() correction, LL in radians per day */
+	T = (JD - 2451545.0) / 36525.0;
+	LL = value[0] + ln_deg_to_rad((-1.397 - 0.00031 * T) * T);
+	dLL = ln_deg_to_rad(velocity->L - (1.397 + 0.00062 * T) / 36525.0);
+	cos_LL = cos(LL);
+	sin_LL = sin(LL);
+	B = value[1];
+	k = 0.03916 / 3600.0;
+
+	velocity->L += k * ((cos_LL - sin_LL) * dLL * tan(B) +
+		(cos_LL + sin_LL) * ln_deg_to_rad(velocity->B) / (cos(B) * cos(B)));
+	velocity->B -= k * (cos_LL + sin_LL) * dLL;
+
+	position->L = value[0];
+	position->B = value[1];
+	position->R = value[2];
+	finish_helio_coords(position, JD);
+}
+
+/* The velocity is the rate of the rectangular position of
+ * vsop87_get_rect_helio(). The FK5 rotation vector changes by about 1e-7 of
+ * itself per century so its own rate is left out. helio, if not NULL, gets
+ * the position of vsop87_get_helio_coords() from the same sums. */
+void vsop87_get_rect_posvel(const struct vsop87_planet *planet, double JD,
+	struct ln_rect_posn *position, struct ln_rect_posn *velocity,
+	struct ln_helio_posn *helio)
+{
+	double value[3], rate[3], w[3], r[3], v[3];
+	double cos_L, sin_L, cos_B, sin_B, dL, dB, dR;
+
+	sum_coords_posvel(planet, (JD - 2451545.0) / 365250.0, value, rate);
+
+	cos_L = cos(value[0]);
+	sin_L = sin(value[0]);
+	cos_B = cos(value[1]);
+	sin_B = sin(value[1]);
+
+	r[0] = value[2] * cos_B * cos_L;
+	r[1] = value[2] * cos_B * sin_L;
+	r[2] = value[2] * sin_B;
+
+	/* radians and AU per millennium to per day */
+	dL = rate[0] / 365250.0;
+	dB = rate[1] / 365250.0;
+	dR = rate[2] / 365250.0;
+
+	v[0] = dR * cos_B * cos_L - value[2] * (dL * cos_B * sin_L +
+		dB * sin_B * cos_L);
+	v[1] = dR * cos_B * sin_L + value[2] * (dL * cos_B * cos_L -
+		dB * sin_B * sin_L);
+	v[2] = dR * sin_B + value[2] * dB * cos_B;
+
+	fk5_rotation(JD, w);
+	rotate_to_equ(w, r, position);
+	rotate_to_equ(w, v, velocity);
+
+	if (helio) {
+		helio->L = value[0];
+		helio->B = value[1];
+		helio->R = value[2];
+		finish_helio_coords(helio, JD);
+	}
+}
+
+/* Each term of a series is loaded once per block of BATCH_EPOCHS times and
+ * applied to all of them, so the vector kernels run across time. */
+void vsop87_get_helio_coords_batch(const struct vsop87_planet *planet,
+	const double *JD, size_t n, struct ln_helio_posn *position)
+{
+	double t[BATCH_EPOCHS], value[3][BATCH_EPOCHS];
+	size_t done;
+	int k, epochs;
+
+	for (done = 0; done < n; done += epochs) {
+		epochs = n - done < BATCH_EPOCHS ? n - done : BATCH_EPOCHS;
+
+		for (k = 0; k < epochs; k++)
+			t[k] = (JD[done + k] - 2451545.0) / 365250.0;
+
+		sum_coords_batch(planet, t, epochs, value);
+
+		for (k = 0; k < epochs; k++) {
+			position[done + k].L = value[0][k];
+			position[done + k].B = value[1][k];
+			position[done + k].R = value[2][k];
+			finish_helio_coords(&position[done + k], JD[done + k]);
+		}
+	}
+}
+
+void vsop87_get_rect_helio(const struct vsop87_planet *planet, double JD,
+	struct ln_rect_posn *position)
+{
+	double value[3];
+
+	sum_coords(planet, (JD - 2451545.0) / 365250.0, 0.0, value);
+	finish_rect_helio(value, JD, position);
+}
+
+void vsop87_get_rect_helio_batch(const struct vsop87_planet *planet,
+	const double *JD, size_t n, struct ln_rect_posn *position)
+{
+	double t[BATCH_EPOCHS], value[3][BATCH_EPOCHS], v[3];
+	size_t done;
+	int k, epochs;
+
+	for (done = 0; done < n; done += epochs) {
+		epochs = n - done < BATCH_EPOCHS ? n - done : BATCH_EPOCHS;
+
+		for (k = 0; k < epochs; k++)
+			t[k] = (JD[done + k] - 2451545.0) / 365250.0;
+
+		sum_coords_batch(planet, t, epochs, value);
+
+		for (k = 0; k < epochs; k++) {
+			v[0] = value[0][k];
+			v[1] = value[1][k];
+			v[2] = value[2][k];
+			finish_rect_helio(v, JD[done + k], &position[done + k]);
+		}
+	}
+}
+
+/* Blocks of SWEEP_RESET epochs, each starting from a direct evaluation
+ * of every term, as the batch functions but without a cos() per term and
+ * epoch. */
+void vsop87_get_helio_coords_sweep(const struct vsop87_planet *planet,
+	double JD, double step, size_t n, struct ln_helio_posn *position)
+{
+	const struct vsop87_coord *coord[3] = {&planet->L, &planet->B, &planet->R};
+	double S[VSOP87_POWERS][SWEEP_RESET], Sn[VSOP87_POWERS];
+	double t[SWEEP_RESET], value[3][SWEEP_RESET], dt;
+	size_t done;
+	int i, j, k, epochs;
+
+	data_load(planet->body);
+
+	dt = step / 365250.0;
+
+	for (done = 0; done < n; done += epochs) {
+		epochs = n - done < SWEEP_RESET ? n - done : SWEEP_RESET;
+
+		for (k = 0; k < epochs; k++)
+			t[k] = (JD + (done + k) * step - 2451545.0) / 365250.0;
+
+		for (i = 0; i < 3; i++) {
+			memset(S, 0, sizeof(S));
+			for (j = 0; j < coord[i]->powers; j++)
+				calc_series_sweep(coord[i]->series[j].A,
+					coord[i]->series[j].B,
+					coord[i]->series[j].C,
+					coord[i]->series[j].count, t[0], dt,
+					epochs, S[j]);
+
+			for (k = 0; k < epochs; k++) {
+				for (j = 0; j < coord[i]->powers; j++)
+					Sn[j] = S[j][k];
+				value[i][k] = calc_coord(Sn, coord[i]->powers, t[k]);
+			}
+		}
+
+		for (k = 0; k < epochs; k++) {
+			position[done + k].L = value[0][k];
+			position[done + k].B = value[1][k];
+			position[done + k].R = value[2][k];
+			finish_helio_coords(&position[done + k],
+				JD + (done + k) * step);
+		}
+	}
+}
+
+/* The head terms are summed as any other series and the rest by the float
+ * kernel, with t rounded to a float. */
+double float_calc_series(const struct float_series *series, double t)
+{
+	return calc_series(series->head_A, series->head_B, series->head_C,
+			series->heads, t) +
+		calc_float_series(series->A, series->B, series->C,
+			series->count, (float)t);
+}
+
+/* As vsop87_get_helio_coords() but each series summed by
+ * float_calc_series(). mkseries leaves no more than 1e-4 radians or AU of
+ * each series to the float kernels. */
+void vsop87_get_helio_coords_float(const struct float_planet *planet,
+	double JD, struct ln_helio_posn *position)
+{
+	const struct float_coord *coord[3] = {&planet->L, &planet->B, &planet->R};
+	double S[VSOP87_POWERS], value[3], t;
+	int i, j;
+
+	data_load(planet->body);
+
+	t = (JD - 2451545.0) / 365250.0;
+
+	for (i = 0; i < 3; i++) {
+		for (j = 0; j < coord[i]->powers; j++)
+			S[j] = float_calc_series(&coord[i]->series[j], t);
+		value[i] = calc_coord(S, coord[i]->powers, t);
+	}
+
+	position->L = value[0];
+	position->B = value[1];
+	position->R = value[2];
+	finish_helio_coords(position, JD);
+}
@@ -0,0 +1,328 @@
+/*
+This program is free software; you can redistribute it and/or modify
+it under the terms of the GNU Library General Public License as published by
+the Free Software Foundation; either version 2 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program; if not, write to the Free Software
+Foundation, Inc., 59 Temple Place - Suite 330, Boston, MA 02111-1307, USA.
+*/
+
+/* Build a Chebyshev ephemeris file for ln_cheb_open() by fitting the
+ * libnova planet and lunar positions over fixed length granules. */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+#include <unistd.h>
+#include <libnova/libnova.h>
+#include "chebyshev-priv.h"
+
+#define RAD_TO_ARCSEC	(180.0 * 3600.0 / M_PI)
+
+/* default span 1900 - 2100 */
+#define DEFAULT_START	2415020.5
+#define DEFAULT_END	2488069.5
+
+/* granule lengths tried, longest first */
+static const double granules[] = {
+	512.0, 256.0, 128.0, 64.0, 32.0, 16.0, 8.0, 4.0, 2.0, 1.0, 0.5, 0.25,
+};
+
+static const char *names[LN_BODIES] = {
+	"mercury", "venus", "earth", "mars", "jupiter",
+	"saturn", "uranus", "neptune", "pluto", "moon",
+};
+
+static void (*const get_helio_coords[LN_BODY_MOON])(double JD,
+	struct ln_helio_posn *position) = {
+	ln_get_mercury_helio_coords,
+	ln_get_venus_helio_coords,
+	ln_get_earth_helio_coords,
+	ln_get_mars_helio_coords,
+	ln_get_jupiter_helio_coords,
+	ln_get_saturn_helio_coords,
+	ln_get_uranus_helio_coords,
+	ln_get_neptune_helio_coords,
+	ln_get_pluto_helio_coords,
+};
+
+struct fit {
+	int body;
+	int coeffs;
+	double granule;
+	uint64_t granules;
+	double *c;		/* granules * 3 * coeffs */
+	double error;		/* worst error in arcsecs */
+};
+
+/* position of body at JD, L or X first */
+static void get_posn(int body, double JD, double *value)
+{
+	struct ln_helio_posn helio;
+	struct ln_rect_posn moon;
+
+	if (body == LN_BODY_MOON) {
+		ln_get_lunar_geo_posn(JD, &moon, 0.0);
+		value[0] = moon.X;
+		value[1] = moon.Y;
+		value[2] = moon.Z;
+	} else {
+		get_helio_coords[body](JD, &helio);
+		value[0] = helio.L;
+		value[1] = helio.B;
+		value[2] = helio.R;
+	}
+}
+
+/* evaluate a fitted granule at x in -1 .. 1 */
+static void cheb_eval(const double *c, int coeffs, double x, double *value)
+{
+	double b0, b1, b2;
+	int i, k;
+
+	for (i = 0; i < 3; i++, c += coeffs) {
+		b1 = b2 = 0.0;
+		for (k = coeffs - 1; k > 0; k--) {
+			b0 = 2.0 * x * b1 - b2 + c[k];
+			b2 = b1;
+			b1 = b0;
+		}
+		value[i] = x * b1 - b2 + c[0];
+	}
+}
+
+/* angular error in arcsecs of value against the series position ref */
+static double posn_error(int body, const double *value, const double *ref)
+{
+	double dL, dB, dR, r;
+
+	if (body == LN_BODY_MOON) {
+		dL = value[0] - ref[0];
+		dB = value[1] - ref[1];
+		dR = value[2] - ref[2];
+		r = sqrt(ref[0] * ref[0] + ref[1] * ref[1] + ref[2] * ref[2]);
+		return sqrt(dL * dL + dB * dB + dR * dR) / r * RAD_TO_ARCSEC;
+	}
+
+	dL = remainder(value[0] - ref[0], 360.0) * 3600.0 *
+		cos(ln_deg_to_rad(ref[1]));
+	dB = (value[1] - ref[1]) * 3600.0;
+	dR = (value[2] - ref[2]) / ref[2] * RAD_TO_ARCSEC;
+	return sqrt(dL * dL + dB * dB + dR * dR);
+}
+
+/* fit one granule starting at JD, return worst error in arcsecs */
+static double fit_granule(int body, double JD, double length, int coeffs,
+	double *c)
+{
+	double f[3][CHEB_MAX_COEFFS], value[3], ref[3], x, sum, error = 0.0;
+	int i, j, k;
+
+	/* sample at the Chebyshev nodes, x from 1 down to -1 */
+	for (j = 0; j < coeffs; j++) {
+		x = cos(M_PI * (j + 0.5) / coeffs);
+		get_posn(body, JD + (x + 1.0) * 0.5 * length, value);
+
+		/* keep longitude continuous within the granule */
+		if (body != LN_BODY_MOON && j > 0)
+			value[0] = f[0][j - 1] + remainder(value[0] - f[0][j - 1], 360.0);
+
+		for (i = 0; i < 3; i++)
+			f[i][j] = value[i];
+	}
+
+	for (i = 0; i < 3; i++) {
+		for (k = 0; k < coeffs; k++) {
+			sum = 0.0;
+			for (j = 0; j < coeffs; j++)
+				sum += f[i][j] * cos(M_PI * k * (j + 0.5) / coeffs);
+			c[i * coeffs + k] = sum * 2.0 / coeffs;
+		}
+		c[i * coeffs] *= 0.5;
+	}
+
+	/* check between the nodes and at both ends */
+	for (j = 0; j <= coeffs; j++) {
+		x = -1.0 + 2.0 * j / coeffs;
+		get_posn(body, JD + (x + 1.0) * 0.5 * length, ref);
+		cheb_eval(c, coeffs, x, value);
+
+		sum = posn_error(body, value, ref);
+		if (sum > error)
+			error = sum;
+	}
+
+	return error;
+}
+
+/* fit body over the span with the longest granule within tolerance */
+static int fit_body(struct fit *fit, double start, double end,
+	double tolerance)
+{
+	double error;
+	uint64_t g;
+	unsigned int i;
+
+	for (i = 0; i < sizeof(granules) / sizeof(granules[0]); i++) {
+		fit->granule = granules[i];
+		fit->granules = (uint64_t)ceil((end - start) / fit->granule);
+		if (fit->granules == 0)
+			fit->granules = 1;
+
+		free(fit->c);
+		fit->c = malloc(fit->granules * 3 * fit->coeffs * sizeof(double));
+		if (fit->c == NULL)
+			return -ENOMEM;
+
+		fit->error = 0.0;
+		for (g = 0; g < fit->granules; g++) {
+			error = fit_granule(fit->body, start + g * fit->granule,
+				fit->granule, fit->coeffs,
+				fit->c + g * 3 * fit->coeffs);
+			if (error > fit->error)
+				fit->error = error;
+			if (error > tolerance)
+				break;
+		}
+
+		if (g == fit->granules)
+			return 0;
+	}
+
+	return -ERANGE;
+}
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "usage: %s [-s start JD] [-e end JD] [-t tolerance arcsecs]\n"
+		"\t[-n coefficients] [-b body[,body...]] [-o file]\n", prog);
+	fprintf(stderr, "bodies: mercury venus earth mars jupiter saturn uranus "
+		"neptune pluto moon\n");
+	exit(-EINVAL);
+}
+
+int main(int argc, char *argv[])
+{
+	struct cheb_header header;
+	struct cheb_body body[LN_BODIES];
+	struct fit fit[LN_BODIES];
+	double start = DEFAULT_START, end = DEFAULT_END, tolerance = 0.001;
+	const char *file = "libnova.cheb";
+	char *bodies = NULL, *tok;
+	int coeffs = 14, use[LN_BODIES], nbodies = 0, opt, i, err;
+	uint64_t offset;
+	FILE *fdo;
+
+	for (i = 0; i < LN_BODIES; i++)
+		use[i] = 1;
+
+	while ((opt = getopt(argc, argv, "s:e:t:n:b:o:h")) != -1) {
+		switch (opt) {
+		case 's':
+			start = atof(optarg);
+			break;
+		case 'e':
+			end = atof(optarg);
+			break;
+		case 't':
+			tolerance = atof(optarg);
+			break;
+		case 'n':
+			coeffs = atoi(optarg);
+			break;
+		case 'b':
+			bodies = optarg;
+			break;
+		case 'o':
+			file = optarg;
+			break;
+		default:
+			usage(argv[0]);
+		}
+	}
+
+	if (end <= start || tolerance <= 0.0 || coeffs < 2 ||
+		coeffs > CHEB_MAX_COEFFS)
+		usage(argv[0]);
+
+	if (bodies) {
+		memset(use, 0, sizeof(use));
+		for (tok = strtok(bodies, ","); tok; tok = strtok(NULL, ",")) {
+			for (i = 0; i < LN_BODIES; i++) {
+				if (!strcmp(tok, names[i]))
+					break;
+			}
+			if (i == LN_BODIES)
+				usage(argv[0]);
+			use[i] = 1;
+		}
+	}
+
+	/* fit each body */
+	memset(fit, 0, sizeof(fit));
+	for (i = 0; i < LN_BODIES; i++) {
+		if (!use[i])
+			continue;
+
+		fit[nbodies].body = i;
+		fit[nbodies].coeffs = coeffs;
+		err = fit_body(&fit[nbodies], start, end, tolerance);
+		if (err < 0) {
+			fprintf(stderr, "error: cannot fit %s within %g arcsecs\n",
+				names[i], tolerance);
+			exit(err);
+		}
+
+		fprintf(stdout, "%s: granule %g days, %llu granules, error %g arcsecs\n",
+			names[i], fit[nbodies].granule,
+			(unsigned long long)fit[nbodies].granules, fit[nbodies].error);
+		nbodies++;
+	}
+
+	/* write header, body table and coefficients */
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, CHEB_MAGIC, sizeof(header.magic));
+	header.byte_order = CHEB_BYTE_ORDER;
+	header.bodies = nbodies;
+	header.start_JD = start;
+	header.end_JD = end;
+
+	offset = sizeof(header) + nbodies * sizeof(body[0]);
+	for (i = 0; i < nbodies; i++) {
+		body[i].body = fit[i].body;
+		body[i].coeffs = fit[i].coeffs;
+		body[i].granules = fit[i].granules;
+		body[i].offset = offset;
+		body[i].granule = fit[i].granule;
+		offset += fit[i].granules * 3 * fit[i].coeffs * sizeof(double);
+	}
+
+	fdo = fopen(file, "wb");
+	if (fdo == NULL) {
+		fprintf(stderr, "error: cannot open output file %s\n", file);
+		exit(-errno);
+	}
+
+	fwrite(&header, sizeof(header), 1, fdo);
+	fwrite(body, sizeof(body[0]), nbodies, fdo);
+	for (i = 0; i < nbodies; i++)
+		fwrite(fit[i].c, sizeof(double),
+			fit[i].granules * 3 * fit[i].coeffs, fdo);
+
+	if (fclose(fdo)) {
+		fprintf(stderr, "error: cannot write output file %s\n", file);
+		exit(-errno);
+	}
+
+	fprintf(stdout, "wrote %s\n", file);
+	return 0;
+}